@@ -0,0 +1,50 @@
+#ifndef ALLOC_TRACKER_H
+#define ALLOC_TRACKER_H
+
+#include <SDL.h>
+
+// Debug allocation counting, compiled in with the TRACK_ALLOCATIONS CMake option. It counts
+// global operator new calls and SDL textures/surfaces created and destroyed through the tracked*
+// wrappers. Without the option the wrappers forward straight to SDL and every count stays zero.
+
+struct AllocationCounts {
+    Uint64 heap;
+    Uint64 sdlObjects;
+    Uint64 sdlObjectsFreed;
+};
+
+AllocationCounts allocationCounts();
+Uint64 allocationsSince(const AllocationCounts &before);
+Uint64 liveSdlObjects(); // Tracked SDL objects created and not yet destroyed
+
+#ifdef TRACK_ALLOCATIONS
+const bool ALLOCATION_TRACKING = true;
+void countSdlObject();
+void countSdlObjectFreed();
+#else
+const bool ALLOCATION_TRACKING = false;
+inline void countSdlObject() {}
+inline void countSdlObjectFreed() {}
+#endif
+
+inline SDL_Texture *trackedCreateTexture(SDL_Renderer *renderer, Uint32 format, int access, int w, int h) {
+    countSdlObject();
+    return SDL_CreateTexture(renderer, format, access, w, h);
+}
+
+inline SDL_Texture *trackedCreateTextureFromSurface(SDL_Renderer *renderer, SDL_Surface *surface) {
+    countSdlObject();
+    return SDL_CreateTextureFromSurface(renderer, surface);
+}
+
+inline void trackedDestroyTexture(SDL_Texture *texture) {
+    countSdlObjectFreed();
+    SDL_DestroyTexture(texture);
+}
+
+inline void trackedFreeSurface(SDL_Surface *surface) {
+    countSdlObjectFreed();
+    SDL_FreeSurface(surface);
+}
+
+#endif // ALLOC_TRACKER_H
@@ -0,0 +1,36 @@
+#ifndef BITBOARD_H
+#define BITBOARD_H
+
+#include "board.h"
+
+// Bitboards: one Row per board row, bit x set if column x is filled, row 0 at the top
+typedef Uint16 Row;
+
+const Row FULL_ROW = (1 << BOARD_WIDTH) - 1;
+
+struct BitBoard {
+    Row rows[BOARD_HEIGHT];
+};
+
+// Rows of a shape at one rotation and column, relative to the piece position
+struct ShapeMask {
+    bool valid; // Inside the walls and not covering the same cells as an earlier rotation/column
+    int rowCount;
+    int dy[4];
+    Row masks[4];
+};
+
+// Fills masks[rotation][x] for the piece's four rotations, reached by rotating from its current
+// orientation, at every column
+void buildShapeMasks(Piece piece, ShapeMask (*masks)[BOARD_WIDTH]);
+
+// Hard drops the shape and clears full rows. Returns the number of lines cleared, or -1 if the
+// shape is not valid or does not fit at the spawn row.
+int placeMask(BitBoard &board, const ShapeMask &shape);
+
+// Removes every full row, as Board does after each lock. Returns the number removed.
+int clearFullRows(BitBoard &board);
+
+int popCount(Row row);
+
+#endif // BITBOARD_H
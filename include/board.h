@@ -2,18 +2,25 @@
 #define BOARD_H
 
 #include "piece.h"
+#include <random>
 
 const int BOARD_WIDTH = 10;
 const int BOARD_HEIGHT = 20;
 
+const double AI_MOVE_BUDGET_MS = 2.0; // Wall-clock budget for one bestMove call
+const int AI_MAX_SEARCH_DEPTH = 4;    // Upper bound on unknown pieces looked ahead
+
 struct Cell {
     bool filled;
     Uint8 color[3];
 };
 
+class SearchContext;
+
 class Board {
 public:
     Board();
+    explicit Board(Uint32 seed); // Piece sequence from this board's own generator
     void draw(SDL_Renderer *renderer);
     void spawnPiece();
     void movePieceLeft();
@@ -21,16 +28,16 @@ public:
     void movePieceDown();
     void dropPiece();
     void rotatePiece();
+    void placePiece(int x, int rotation); // Rotates, shifts towards column x until blocked, hard drops
     bool isPieceFit(const Piece &piece, int x, int y);
     int getScore() const;
     bool isGameOver() const;
-    void bestMove(int& bestX, int& bestRotation);  // Updated function signature
+    bool isCellFilled(int x, int y) const;
+    const Cell &getCell(int x, int y) const;
+    void setCellFilled(int x, int y, bool filled); // For loaded positions; filled cells are gray
+    void bestMove(int& bestX, int& bestRotation, SearchContext &context, double budgetMs = AI_MOVE_BUDGET_MS);
 
-    Piece getCurrentPiece() const; // Access method for currentPiece
-    int evaluateBoard();  // Add this function to evaluate the board state
-    int countHoles();     // Add this function to count the number of holes
-    int aggregateHeight(); // Add this function to calculate the aggregate height
-    int bumpiness();       // Add this function to calculate the bumpiness
+    const Piece &getCurrentPiece() const; // Access method for currentPiece
 
 private:
     Cell grid[BOARD_HEIGHT][BOARD_WIDTH];
@@ -38,6 +45,7 @@ private:
     bool isPieceLocked;
     int score;
     bool gameOver;
+    std::minstd_rand random;
     void lockPiece();
     void clearLines();
 };
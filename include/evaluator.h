@@ -0,0 +1,53 @@
+#ifndef EVALUATOR_H
+#define EVALUATOR_H
+
+#include <vector>
+#include "bitboard.h"
+
+const int FEATURE_COUNT = 2 * BOARD_WIDTH + 1;
+const int MAX_EVAL_BATCH = 7 * 4 * BOARD_WIDTH; // Every placement of every piece type from one position
+
+// What an Evaluator sees of a position: per-column heights, per-column holes and the number of
+// lines cleared on the way to it
+struct BoardFeatures {
+    float values[FEATURE_COUNT];
+};
+
+void extractFeatures(const BitBoard &board, int linesCleared, BoardFeatures &features);
+
+// Scores a batch of positions at once; a higher value is a better position
+class Evaluator {
+public:
+    virtual ~Evaluator() {}
+    virtual void evaluate(const BoardFeatures *features, int count, float *values) = 0;
+};
+
+// -0.5 * aggregate height + 0.76 * lines cleared - 0.35 * holes - 0.18 * bumpiness, in float.
+// Lines cleared are those cleared by the placements on the search path to the position rather
+// than the game score, so moves that clear lines score higher.
+class LinearEvaluator : public Evaluator {
+public:
+    void evaluate(const BoardFeatures *features, int count, float *values) override;
+};
+
+// Small MLP: FEATURE_COUNT inputs, one ReLU hidden layer, one output. Inference runs over the
+// batch in lanes of 4 with SSE when available. Until weights are loaded it scores like
+// LinearEvaluator.
+class NeuralEvaluator : public Evaluator {
+public:
+    NeuralEvaluator();
+    bool load(const char *path);
+    bool isLoaded() const;
+    void evaluate(const BoardFeatures *features, int count, float *values) override;
+
+private:
+    int hiddenCount;
+    std::vector<float> hiddenWeights; // hiddenCount x FEATURE_COUNT, row-major
+    std::vector<float> hiddenBiases;
+    std::vector<float> outputWeights;
+    float outputBias;
+    std::vector<float> inputs;        // Batch transposed to FEATURE_COUNT x MAX_EVAL_BATCH
+    LinearEvaluator fallback;
+};
+
+#endif // EVALUATOR_H
@@ -0,0 +1,28 @@
+#ifndef FONT_H
+#define FONT_H
+
+#include <SDL.h>
+#include <SDL_ttf.h>
+
+const int FONT_POINT_SIZE = 24;
+
+// HUD text drawn from a glyph atlas that is rasterized at build time and embedded in the binary.
+// SDL_ttf is only loaded, at runtime, if a string contains a character the atlas does not cover.
+class Font {
+public:
+    Font();
+    bool load(SDL_Renderer *renderer);
+    void close();
+    void textSize(const char *text, int &w, int &h);
+    void drawText(SDL_Renderer *renderer, const char *text, int x, int y, SDL_Color color);
+
+private:
+    bool isInAtlas(const char *text) const;
+    bool loadTrueType();
+
+    SDL_Texture *atlas;
+    TTF_Font *ttfFont;
+    bool ttfFailed;
+};
+
+#endif // FONT_H
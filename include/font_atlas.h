@@ -0,0 +1,303 @@
+// Generated by tools/fontatlas.cpp at 24 points, do not edit
+#ifndef FONT_ATLAS_H
+#define FONT_ATLAS_H
+
+const int FONT_ATLAS_FIRST_CHAR = 32;
+const int FONT_ATLAS_GLYPH_COUNT = 95;
+const int FONT_ATLAS_WIDTH = 512;
+const int FONT_ATLAS_HEIGHT = 99;
+const int FONT_ATLAS_LINE_HEIGHT = 33;
+
+const int FONT_ATLAS_GLYPH_X[] = {
+    0, 6, 12, 22, 38, 52, 72, 90, 95, 102, 109, 122, 136, 142, 150, 156, 165, 179, 193, 207, 221, 235, 249, 263,
+    277, 291, 305, 311, 317, 331, 345, 359, 369, 391, 407, 423, 438, 455, 468, 480, 0, 18, 25, 33, 48, 61, 83, 101,
+    120, 134, 153, 168, 181, 194, 212, 227, 249, 263, 277, 291, 299, 308, 316, 330, 342, 349, 362, 377, 389, 404, 417, 427,
+    440, 455, 461, 469, 482, 488, 0, 15, 29, 44, 59, 69, 80, 89, 104, 116, 135, 148, 161, 172, 181, 194, 203,
+};
+const int FONT_ATLAS_GLYPH_Y[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 33, 33, 33, 33, 33, 33, 33,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    33, 33, 33, 33, 33, 33, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+};
+const int FONT_ATLAS_GLYPH_W[] = {
+    6, 6, 10, 16, 14, 20, 18, 5, 7, 7, 13, 14, 6, 8, 6, 9, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 6, 6, 14, 14, 14, 10, 22, 16, 16, 15, 17, 13, 12, 17, 18, 7, 8, 15, 13, 22, 18, 19,
+    14, 19, 15, 13, 13, 18, 15, 22, 14, 14, 14, 8, 9, 8, 14, 12, 7, 13, 15, 12, 15, 13, 10, 13,
+    15, 6, 8, 13, 6, 22, 15, 14, 15, 15, 10, 11, 9, 15, 12, 19, 13, 13, 11, 9, 13, 9, 14,
+};
+const int FONT_ATLAS_GLYPH_ADVANCE[] = {
+    6, 6, 10, 16, 14, 20, 17, 5, 7, 7, 13, 14, 6, 8, 6, 9, 14, 14, 14, 14, 14, 14, 14, 14,
+    14, 14, 6, 6, 14, 14, 14, 10, 22, 15, 16, 15, 17, 13, 12, 17, 18, 7, 6, 15, 13, 22, 18, 19,
+    14, 19, 15, 13, 13, 18, 14, 22, 14, 13, 14, 8, 9, 8, 14, 11, 7, 13, 15, 12, 15, 13, 8, 13,
+    15, 6, 6, 13, 6, 22, 15, 14, 15, 15, 10, 11, 9, 15, 12, 19, 13, 12, 11, 9, 13, 9, 14,
+};
+
+const unsigned char FONT_ATLAS_INK[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xc3, 0x0c, 0x30, 0x06, 0x30, 0x80, 0x03, 0x04, 0xe0, 0x03, 0x30, 0x98, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x3e, 0x00, 0x06,
+    0xe0, 0x03, 0xf8, 0x00, 0xe0, 0xc0, 0x3f, 0x80, 0x0f, 0xff, 0x0f, 0x7e, 0x80, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0xfe,
+    0x00, 0xe0, 0x00, 0xfe, 0x03, 0xc0, 0x0f, 0xff, 0x01, 0xfe, 0xc7, 0xff, 0x80, 0x3f, 0x00, 0x00, 0x00, 0xc3, 0x0c, 0x10, 0x02, 0xfc, 0xc1, 0x06,
+    0x06, 0xf0, 0x07, 0x30, 0x0c, 0x03, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0x00, 0x07, 0xf8, 0x0f, 0xfe, 0x03, 0xe0, 0xe0, 0x3f, 0xe0,
+    0x0f, 0xff, 0x0f, 0xff, 0xc0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0xef, 0x03, 0xe0, 0x00, 0xfe, 0x0f, 0xf0, 0x1f, 0xff,
+    0x07, 0xfe, 0xc7, 0xff, 0xe0, 0x7f, 0x00, 0x00, 0x00, 0xc3, 0x0c, 0x18, 0x02, 0xff, 0x41, 0x0c, 0x03, 0x18, 0x06, 0x30, 0x0c, 0x43, 0x08, 0x01,
+    0x03, 0x00, 0x00, 0x00, 0x8c, 0xc3, 0x80, 0x05, 0x18, 0x0c, 0x02, 0x03, 0xf0, 0x60, 0x00, 0x70, 0x00, 0x00, 0x86, 0xc1, 0x61, 0x30, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x04, 0x00, 0xc1, 0xe0, 0x00, 0x06, 0xa0, 0x00, 0x06, 0x0c, 0x3c, 0x10, 0x03, 0x0e, 0x06, 0xc0, 0x00, 0x70, 0x40, 0x00, 0x00,
+    0x00, 0x43, 0x0c, 0x18, 0x03, 0x33, 0x60, 0x0c, 0x03, 0x18, 0x06, 0x10, 0x06, 0xc6, 0xeb, 0x01, 0x03, 0x00, 0x00, 0x00, 0x86, 0x81, 0xe1, 0x04,
+    0x00, 0x18, 0x00, 0x06, 0xd8, 0x60, 0x00, 0x30, 0x00, 0x00, 0x86, 0x81, 0x61, 0x60, 0x00, 0x00, 0x80, 0x01, 0x00, 0x1c, 0x00, 0x80, 0x61, 0x00,
+    0x0c, 0xb0, 0x01, 0x06, 0x1c, 0x0c, 0x00, 0x03, 0x1c, 0x06, 0xc0, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x43, 0x0c, 0x18, 0x83, 0x31, 0x60, 0x88,
+    0x01, 0x18, 0x06, 0x10, 0x06, 0xc6, 0xff, 0x01, 0x03, 0x00, 0x00, 0x00, 0x86, 0x81, 0x41, 0x04, 0x00, 0x18, 0x00, 0x06, 0xcc, 0x60, 0x00, 0x18,
+    0x00, 0x00, 0x83, 0x81, 0x31, 0x60, 0x18, 0x06, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x80, 0x31, 0x00, 0x08, 0xb0, 0x01, 0x06, 0x18, 0x0e, 0x00, 0x03,
+    0x18, 0x06, 0xc0, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x43, 0x8c, 0xff, 0x1f, 0x33, 0x60, 0x88, 0x00, 0x18, 0x06, 0x10, 0x06, 0x06, 0x1c, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0xc2, 0x80, 0x01, 0x04, 0x00, 0x18, 0x00, 0x07, 0xcc, 0x60, 0x00, 0x18, 0x00, 0x00, 0x83, 0x81, 0x31, 0x60, 0x38, 0x06,
+    0x38, 0xf0, 0x7f, 0xc0, 0x01, 0xc0, 0x18, 0xfc, 0x18, 0x30, 0x03, 0x06, 0x0c, 0x06, 0x00, 0x03, 0x38, 0x06, 0xc0, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x08, 0x01, 0x33, 0x60, 0xc8, 0x1e, 0x30, 0x03, 0x00, 0x03, 0x0c, 0x36, 0x00, 0x03, 0x00, 0x00, 0x00, 0xc3, 0x80, 0x01, 0x04,
+    0x00, 0x0c, 0x00, 0x03, 0xc6, 0x60, 0x00, 0xc8, 0x07, 0x80, 0x01, 0xe3, 0x30, 0x60, 0x18, 0x06, 0x0e, 0xf0, 0x7f, 0x00, 0x07, 0xc0, 0x18, 0xef,
+    0x18, 0x18, 0x03, 0x06, 0x0c, 0x06, 0x00, 0x03, 0x30, 0x06, 0xc0, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0c, 0x01, 0x3e, 0x60, 0x4c,
+    0x3f, 0xe0, 0x01, 0x00, 0x03, 0x0c, 0x76, 0xf8, 0x3f, 0x00, 0x00, 0x00, 0xc3, 0x80, 0x01, 0x04, 0x00, 0x0c, 0xf8, 0x01, 0xc3, 0xe0, 0x0f, 0xec,
+    0x0f, 0x80, 0x01, 0x7e, 0x30, 0x60, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x1c, 0x70, 0x08, 0xc3, 0x10, 0x18, 0x03, 0xfe, 0x07, 0x07, 0x00, 0x03,
+    0x30, 0xfe, 0xc3, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x8c, 0x01, 0xfc, 0x40, 0x6c, 0x23, 0xf0, 0x00, 0x00, 0x03, 0x0c, 0x63, 0xf8,
+    0x3f, 0x00, 0x00, 0x80, 0xc1, 0x00, 0x03, 0x04, 0x00, 0x06, 0xf8, 0x01, 0xc1, 0xe0, 0x3f, 0x3c, 0x18, 0xc0, 0x00, 0x7e, 0x60, 0x70, 0x00, 0xc0,
+    0x01, 0x00, 0x00, 0x00, 0x18, 0x38, 0x8c, 0xc1, 0x10, 0x0c, 0x06, 0xfe, 0x07, 0x07, 0x00, 0x03, 0x30, 0xfe, 0xc3, 0x7f, 0x0e, 0xfc, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x8c, 0x01, 0xf0, 0xc1, 0x36, 0x21, 0xb8, 0xc1, 0x00, 0x03, 0x0c, 0x62, 0x00, 0x03, 0x80, 0x1f, 0x80, 0xc1, 0x80, 0x01, 0x04,
+    0x00, 0x03, 0x80, 0x83, 0xc1, 0x00, 0x70, 0x1c, 0x18, 0xc0, 0x00, 0xe3, 0xe0, 0x7f, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0e, 0x18, 0x8c, 0xc1,
+    0x18, 0x0c, 0x06, 0x06, 0x0c, 0x07, 0x00, 0x03, 0x30, 0x06, 0xc0, 0x7f, 0x0e, 0xfc, 0x00, 0x00, 0x00, 0x03, 0x80, 0xff, 0x0f, 0x30, 0x83, 0x37,
+    0x61, 0x0c, 0xc3, 0x00, 0x03, 0x0c, 0x00, 0x00, 0x03, 0x80, 0x1f, 0x80, 0xc1, 0x80, 0x01, 0x04, 0x80, 0x01, 0x00, 0xc6, 0xc0, 0x00, 0x60, 0x0c,
+    0x30, 0x60, 0x80, 0x81, 0x81, 0x6f, 0x00, 0x00, 0x3c, 0xf0, 0x7f, 0xc0, 0x03, 0x0c, 0x8c, 0xc1, 0x18, 0xfc, 0x0f, 0x06, 0x18, 0x06, 0x00, 0x03,
+    0x30, 0x06, 0xc0, 0x00, 0x0c, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x30, 0x03, 0x18, 0x61, 0x0e, 0x6e, 0x00, 0x03, 0x0c, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0xc0, 0xc0, 0x80, 0x01, 0x04, 0xc0, 0x00, 0x00, 0xc6, 0xff, 0x03, 0x60, 0x0c, 0x30, 0x60, 0xc0, 0x80, 0x01, 0x60, 0x00, 0x00,
+    0xf0, 0xf0, 0x7f, 0xf0, 0x00, 0x0c, 0x8c, 0xe1, 0x18, 0xfe, 0x0f, 0x06, 0x18, 0x06, 0x00, 0x03, 0x38, 0x06, 0xc0, 0x00, 0x0c, 0xc0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x86, 0x00, 0x30, 0x03, 0x18, 0x61, 0x06, 0x7c, 0x00, 0x03, 0x0c, 0x00, 0x00, 0x03, 0x00, 0x00, 0xc0, 0x80, 0x81, 0x01, 0x04,
+    0x60, 0x00, 0x00, 0xc6, 0xff, 0x03, 0x60, 0x18, 0x10, 0x70, 0xc0, 0x00, 0x01, 0x60, 0x00, 0x00, 0xc0, 0x01, 0x00, 0x3c, 0x00, 0x00, 0x08, 0xb7,
+    0x0d, 0x06, 0x0c, 0x06, 0x18, 0x06, 0x00, 0x03, 0x18, 0x06, 0xc0, 0x00, 0x0c, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x80, 0x30, 0x03, 0x0c,
+    0x21, 0x06, 0x38, 0x00, 0x03, 0x0c, 0x00, 0x00, 0x03, 0x00, 0x00, 0x40, 0x80, 0x81, 0x01, 0x04, 0x30, 0x00, 0x00, 0x06, 0xc0, 0x00, 0x60, 0x18,
+    0x18, 0x30, 0xc0, 0x80, 0x01, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x18, 0x9e, 0x07, 0x07, 0x18, 0x06, 0x18, 0x0c, 0x00, 0x03,
+    0x1c, 0x06, 0xc0, 0x00, 0x18, 0xc0, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc6, 0x80, 0xff, 0x01, 0x04, 0x23, 0x0c, 0x7c, 0x00, 0x03, 0x0c, 0x00, 0x00,
+    0x00, 0x0c, 0x00, 0x63, 0x80, 0xc3, 0x00, 0x04, 0x18, 0x00, 0x01, 0x07, 0xc0, 0x00, 0x70, 0x30, 0x1c, 0x30, 0x80, 0x81, 0x01, 0x38, 0x18, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x00, 0x00, 0x03, 0x18, 0x06, 0x1c, 0x1c, 0x00, 0x03, 0x0e, 0x06, 0xc0, 0x00, 0x78, 0xc0, 0x00, 0x00,
+    0x00, 0x07, 0x00, 0xc6, 0x00, 0x7f, 0x00, 0x06, 0x3f, 0xfc, 0xef, 0x00, 0x06, 0x06, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x67, 0x00, 0xff, 0x00, 0x04,
+    0xfc, 0x1f, 0xff, 0x03, 0xc0, 0xe0, 0x3f, 0xf0, 0x0f, 0x18, 0x80, 0xff, 0xe0, 0x1f, 0x38, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x30, 0x00,
+    0x00, 0x03, 0x38, 0xfe, 0x0f, 0xf8, 0x1f, 0xff, 0x07, 0xfe, 0xc7, 0x00, 0xf0, 0xff, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc2, 0x00, 0x30, 0x00, 0x02,
+    0x1e, 0xf0, 0xc3, 0x01, 0x06, 0x06, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x33, 0x00, 0x3e, 0x00, 0x04, 0xfc, 0x1f, 0xfe, 0x00, 0xc0, 0xe0, 0x0f, 0xc0,
+    0x07, 0x18, 0x00, 0x7e, 0xe0, 0x07, 0x18, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x60, 0x00, 0x80, 0x01, 0x30, 0xfe, 0x03, 0xe0, 0x0f, 0xff,
+    0x01, 0xfe, 0xc7, 0x00, 0xc0, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xe0, 0x03, 0x00, 0x0c, 0x00, 0x00, 0x80, 0x01, 0x30, 0x00, 0x00, 0x00,
+    0x0c, 0x60, 0x30, 0x60, 0x18, 0x60, 0x0c, 0x80, 0x03, 0xe0, 0xe0, 0x00, 0x06, 0xf8, 0x03, 0xfc, 0x03, 0xf0, 0x07, 0xf8, 0x07, 0xf0, 0xe3, 0xff,
+    0x33, 0x80, 0x31, 0x00, 0x3b, 0x60, 0x80, 0x0d, 0xb0, 0x01, 0xcc, 0xff, 0xe3, 0x1b, 0xe0, 0x03, 0x04, 0x00, 0x00, 0x06, 0x00, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0xf0, 0x03, 0x00, 0x0c, 0x00, 0x06, 0x86, 0x01, 0x30, 0x00, 0x00, 0x00, 0x0c, 0x60, 0x30, 0x60, 0x18, 0x30, 0x0c, 0x80,
+    0x07, 0xe0, 0xe0, 0x01, 0x06, 0xfe, 0x07, 0xfc, 0x0f, 0xfc, 0x0f, 0xf8, 0x1f, 0xf8, 0xe7, 0xff, 0x33, 0x80, 0x61, 0x00, 0x33, 0x60, 0xc0, 0x1c,
+    0x18, 0x03, 0xce, 0xff, 0xe3, 0x33, 0xe0, 0x03, 0x0e, 0x00, 0x00, 0x0c, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x30, 0x00, 0x00, 0x0c,
+    0x00, 0x06, 0x86, 0x01, 0x30, 0x00, 0x00, 0x00, 0x0c, 0x60, 0x30, 0x60, 0x18, 0x18, 0x0c, 0x80, 0x07, 0xf0, 0xe0, 0x01, 0x06, 0x07, 0x0e, 0x0c,
+    0x1c, 0x0e, 0x1c, 0x18, 0x38, 0x0c, 0x00, 0x18, 0x30, 0x80, 0x61, 0x80, 0x31, 0xf0, 0xc0, 0x18, 0x18, 0x07, 0x06, 0x80, 0x61, 0x30, 0x00, 0x03,
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x30, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x80, 0x01, 0x30, 0x00, 0x00, 0x00,
+    0x0c, 0x60, 0x30, 0x60, 0x18, 0x0c, 0x0c, 0x80, 0x0d, 0xf0, 0x60, 0x03, 0x06, 0x03, 0x18, 0x0c, 0x18, 0x06, 0x30, 0x18, 0x30, 0x0e, 0x00, 0x18,
+    0x30, 0x80, 0x61, 0x80, 0x31, 0xf0, 0xc0, 0x30, 0x0c, 0x06, 0x07, 0xc0, 0x60, 0x20, 0x00, 0x03, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x30, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x80, 0x01, 0x30, 0x00, 0x00, 0x00, 0x0c, 0x60, 0x30, 0x60, 0x18, 0x06, 0x0c, 0x80,
+    0x0d, 0xd0, 0x60, 0x07, 0x86, 0x01, 0x38, 0x0c, 0x18, 0x03, 0x70, 0x18, 0x30, 0x06, 0x00, 0x18, 0x30, 0x80, 0xc1, 0x80, 0x61, 0xb0, 0xc0, 0x70,
+    0x06, 0x0e, 0x03, 0xe0, 0x60, 0x60, 0x00, 0x03, 0x33, 0x00, 0x00, 0x00, 0x3e, 0x30, 0x0f, 0xc0, 0x07, 0x3e, 0x03, 0x1e, 0xfc, 0x81, 0xff, 0xcc,
+    0x07, 0x06, 0x86, 0xc1, 0x31, 0xcc, 0xc3, 0x03, 0x0c, 0x60, 0x30, 0x60, 0x18, 0x03, 0x0c, 0x80, 0x0d, 0xd8, 0x60, 0x06, 0x86, 0x01, 0x30, 0x0c,
+    0x18, 0x03, 0x60, 0x18, 0x30, 0x0c, 0x00, 0x18, 0x30, 0x80, 0xc1, 0xc0, 0x60, 0x98, 0x61, 0x60, 0x06, 0x8c, 0x01, 0x60, 0x60, 0x60, 0x00, 0x83,
+    0x31, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x3f, 0xf0, 0x07, 0x7f, 0x83, 0x7f, 0xfe, 0xe1, 0x7d, 0xfc, 0x0f, 0x06, 0x86, 0xe1, 0x30, 0xfc, 0xf7, 0x0f,
+    0x0c, 0x60, 0x30, 0x60, 0x98, 0x01, 0x0c, 0x80, 0x19, 0xd8, 0x60, 0x0c, 0x86, 0x01, 0x30, 0x0c, 0x18, 0x03, 0x60, 0x18, 0x30, 0x1c, 0x00, 0x18,
+    0x30, 0x80, 0xc1, 0xc0, 0x60, 0x98, 0x61, 0xc0, 0x03, 0x98, 0x01, 0x30, 0x60, 0xc0, 0x00, 0x83, 0x61, 0x00, 0x00, 0x00, 0xc0, 0x70, 0x70, 0x38,
+    0x80, 0x83, 0xc3, 0x61, 0x30, 0x60, 0x30, 0x1c, 0x0c, 0x06, 0x86, 0x71, 0x30, 0x1c, 0x1c, 0x0c, 0xfc, 0x7f, 0x30, 0x60, 0xd8, 0x01, 0x0c, 0x80,
+    0x19, 0xcc, 0x60, 0x1c, 0xc6, 0x01, 0x30, 0x0c, 0x9c, 0x03, 0x60, 0x18, 0x18, 0x78, 0x00, 0x18, 0x30, 0x80, 0x81, 0xc1, 0x60, 0x98, 0x61, 0xc0,
+    0x01, 0xd8, 0x00, 0x38, 0x60, 0xc0, 0x00, 0x83, 0x60, 0x00, 0x00, 0x00, 0xc0, 0x30, 0x60, 0x18, 0x80, 0x81, 0xc3, 0xc0, 0x30, 0x30, 0x30, 0x0c,
+    0x18, 0x06, 0x86, 0x31, 0x30, 0x0c, 0x1c, 0x0c, 0xfc, 0x7f, 0x30, 0x60, 0xf8, 0x01, 0x0c, 0x80, 0x31, 0xcc, 0x60, 0x18, 0xc6, 0x01, 0x30, 0xfc,
+    0x8f, 0x03, 0x60, 0xf8, 0x1f, 0xf0, 0x01, 0x18, 0x30, 0x80, 0x81, 0x61, 0xc0, 0x0c, 0x63, 0x80, 0x01, 0xf0, 0x00, 0x18, 0x60, 0xc0, 0x00, 0xc3,
+    0xc0, 0x00, 0x00, 0x00, 0xc0, 0x30, 0x60, 0x18, 0xc0, 0x01, 0xc3, 0xc0, 0x30, 0x30, 0x30, 0x0c, 0x18, 0x06, 0x86, 0x19, 0x30, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x60, 0x30, 0x60, 0x38, 0x03, 0x0c, 0x80, 0x31, 0xc4, 0x60, 0x30, 0xc6, 0x01, 0x30, 0xfc, 0x83, 0x03, 0x60, 0xf8, 0x07, 0x80, 0x07, 0x18,
+    0x30, 0x80, 0x81, 0x61, 0xc0, 0x0c, 0x33, 0xc0, 0x03, 0x70, 0x00, 0x0c, 0x60, 0x80, 0x01, 0x43, 0xc0, 0x00, 0x00, 0x00, 0xfe, 0x30, 0x60, 0x0c,
+    0xc0, 0x00, 0xe3, 0xff, 0x30, 0x60, 0x30, 0x0c, 0x18, 0x06, 0x86, 0x0d, 0x30, 0x0c, 0x0c, 0x0c, 0x0c, 0x60, 0x30, 0x60, 0x18, 0x07, 0x0c, 0x80,
+    0x31, 0xc6, 0x60, 0x70, 0x86, 0x01, 0x30, 0x0c, 0x00, 0x03, 0x60, 0x18, 0x06, 0x00, 0x0e, 0x18, 0x30, 0x80, 0x01, 0x73, 0xc0, 0x0c, 0x33, 0x60,
+    0x07, 0x60, 0x00, 0x0e, 0x60, 0x80, 0x01, 0x63, 0x80, 0x01, 0x00, 0x80, 0xcf, 0x30, 0x60, 0x0c, 0xc0, 0x00, 0xe3, 0xff, 0x30, 0xe0, 0x1d, 0x0c,
+    0x18, 0x06, 0x86, 0x1f, 0x30, 0x0c, 0x0c, 0x0c, 0x0c, 0x60, 0x30, 0x60, 0x18, 0x0e, 0x0c, 0x80, 0x61, 0xc6, 0x60, 0x60, 0x86, 0x01, 0x30, 0x0c,
+    0x00, 0x03, 0x60, 0x18, 0x0c, 0x00, 0x0c, 0x18, 0x30, 0x80, 0x01, 0x33, 0xc0, 0x0c, 0x32, 0x60, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, 0x03, 0x03,
+    0x00, 0x00, 0x00, 0xc0, 0xc1, 0x30, 0x60, 0x0c, 0xc0, 0x00, 0x63, 0x00, 0x30, 0x80, 0x0f, 0x0c, 0x18, 0x06, 0x86, 0x1b, 0x30, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x60, 0x30, 0x60, 0x18, 0x0c, 0x0c, 0x80, 0x61, 0xc3, 0x60, 0xe0, 0x86, 0x01, 0x38, 0x0c, 0x00, 0x03, 0x70, 0x18, 0x1c, 0x00, 0x0c, 0x18,
+    0x30, 0x80, 0x01, 0x36, 0x80, 0x07, 0x16, 0x30, 0x0c, 0x60, 0x00, 0x03, 0x60, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0x30, 0x60, 0x18,
+    0xc0, 0x01, 0xc3, 0x00, 0x30, 0x40, 0x00, 0x0c, 0x18, 0x06, 0x86, 0x31, 0x30, 0x0c, 0x0c, 0x0c, 0x0c, 0x60, 0x30, 0x60, 0x18, 0x18, 0x0c, 0x80,
+    0x41, 0xc3, 0x60, 0xc0, 0x06, 0x03, 0x18, 0x0c, 0x00, 0x06, 0x30, 0x18, 0x18, 0x00, 0x0c, 0x18, 0x60, 0x80, 0x01, 0x1e, 0x80, 0x07, 0x1e, 0x18,
+    0x1c, 0x60, 0x80, 0x03, 0x60, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0x30, 0x60, 0x18, 0x80, 0x81, 0xc3, 0x00, 0x30, 0x60, 0x00, 0x0c,
+    0x18, 0x06, 0x86, 0x71, 0x30, 0x0c, 0x0c, 0x0c, 0x0c, 0x60, 0x30, 0x60, 0x18, 0x38, 0x0c, 0x80, 0xc1, 0xc1, 0x60, 0x80, 0x07, 0x07, 0x0c, 0x0c,
+    0x00, 0x0e, 0x18, 0x18, 0x30, 0x02, 0x0e, 0x18, 0xe0, 0xc0, 0x00, 0x1e, 0x80, 0x07, 0x1e, 0x18, 0x18, 0x60, 0x80, 0x01, 0x60, 0x00, 0x06, 0x03,
+    0x00, 0x00, 0x00, 0xc0, 0xe0, 0x70, 0x30, 0x38, 0x80, 0x83, 0xc3, 0x01, 0x30, 0x60, 0x00, 0x0c, 0x18, 0x06, 0x86, 0xe1, 0x30, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x60, 0x30, 0x60, 0x18, 0x70, 0xfc, 0x8f, 0xc1, 0xc1, 0x60, 0x80, 0x07, 0xfe, 0x07, 0x0c, 0x00, 0xfc, 0x0f, 0x18, 0x30, 0xfe, 0x07, 0x18,
+    0xc0, 0x7f, 0x00, 0x1c, 0x80, 0x03, 0x1c, 0x0c, 0x30, 0x60, 0xc0, 0xff, 0x63, 0x00, 0x06, 0x03, 0x00, 0x00, 0x00, 0x80, 0xbf, 0xf0, 0x3f, 0xf0,
+    0x0f, 0x7f, 0x83, 0xff, 0x30, 0xc0, 0x3f, 0x0c, 0x18, 0x06, 0x86, 0xc1, 0x30, 0x0c, 0x0c, 0x0c, 0x0c, 0x60, 0x30, 0x60, 0x18, 0x60, 0xfc, 0x8f,
+    0x81, 0xc1, 0x60, 0x00, 0x07, 0xf8, 0x01, 0x0c, 0x00, 0xf0, 0x03, 0x18, 0x60, 0xfc, 0x01, 0x18, 0x00, 0x3f, 0x00, 0x0c, 0x00, 0x03, 0x0c, 0x0e,
+    0x30, 0x60, 0xc0, 0xff, 0x63, 0x00, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x30, 0x0f, 0xc0, 0x07, 0x3e, 0x03, 0x7e, 0x30, 0xe0, 0x7f, 0x0c,
+    0x18, 0x06, 0x86, 0x81, 0x31, 0x0c, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x60, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x60, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xe0, 0x03, 0xe0, 0x03, 0x00, 0xf8, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x60, 0x00,
+    0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x03, 0xe0, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x60, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x0f, 0x00,
+    0x00, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x08,
+    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x08, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x08, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x08,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x07, 0xf0, 0x81, 0x79, 0x00, 0x9f, 0x61,
+    0x0e, 0x3f, 0xfe, 0x18, 0x30, 0x03, 0x3c, 0x70, 0x30, 0x03, 0x37, 0xc0, 0xfc, 0x07, 0x01, 0x08, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x0f, 0xfc, 0x83, 0xff, 0x81, 0xbf, 0x61, 0x8f, 0x7f, 0xff, 0x18, 0x30, 0x06, 0x66, 0x70,
+    0x30, 0x06, 0x63, 0x60, 0xfc, 0x07, 0x01, 0x08, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1c, 0x0c, 0x0e, 0x86, 0x83, 0xc3, 0xc1, 0xe1, 0xc1, 0x00, 0x0c, 0x18, 0x30, 0x06, 0x66, 0x70, 0x30, 0x8e, 0x61, 0x60, 0x00, 0x03, 0x01, 0x08,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x06, 0x8c, 0x01, 0xc3, 0xc0, 0xe1,
+    0xc0, 0x00, 0x0c, 0x18, 0x30, 0x06, 0x66, 0x58, 0x18, 0xcc, 0x60, 0x60, 0x00, 0x03, 0x01, 0x08, 0x40, 0xe0, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x06, 0x8c, 0x01, 0xe3, 0xc0, 0x61, 0xc0, 0x01, 0x0c, 0x18, 0x30, 0x0c, 0x43, 0xd8,
+    0x18, 0xd8, 0xc0, 0x30, 0x80, 0x81, 0x01, 0x08, 0xc0, 0xf0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0c, 0x18, 0x03, 0x8c, 0x01, 0x63, 0x80, 0x61, 0x80, 0x07, 0x0c, 0x18, 0x30, 0x0c, 0xc3, 0xc8, 0x18, 0x70, 0xc0, 0x30, 0xc0, 0xe0, 0x01, 0x08,
+    0xc0, 0x13, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x03, 0x8c, 0x01, 0x63, 0x80, 0x61,
+    0x00, 0x1e, 0x0c, 0x18, 0x30, 0x0c, 0xc3, 0x8c, 0x18, 0x70, 0x80, 0x31, 0xc0, 0xe0, 0x00, 0x08, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x03, 0x8c, 0x01, 0x63, 0x80, 0x61, 0x00, 0x78, 0x0c, 0x18, 0x30, 0x98, 0xc1, 0x8c,
+    0x0d, 0x78, 0x80, 0x19, 0x60, 0x80, 0x01, 0x08, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0c, 0x18, 0x06, 0x8c, 0x01, 0xe3, 0x80, 0x61, 0x00, 0x60, 0x0c, 0x18, 0x30, 0x98, 0x81, 0x84, 0x0d, 0xd8, 0x80, 0x19, 0x30, 0x80, 0x01, 0x08,
+    0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x06, 0x8c, 0x01, 0xc3, 0xc0, 0x61,
+    0x00, 0x60, 0x0c, 0x18, 0x38, 0x90, 0x80, 0x87, 0x0d, 0xcc, 0x01, 0x1b, 0x38, 0x00, 0x01, 0x08, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x0e, 0x86, 0x83, 0xc1, 0xc1, 0x61, 0x00, 0x60, 0x0c, 0x38, 0x38, 0xf0, 0x80, 0x07,
+    0x05, 0x86, 0x01, 0x0f, 0x18, 0x00, 0x01, 0x08, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0c, 0x18, 0xfc, 0x83, 0xff, 0x81, 0xbf, 0x61, 0xc0, 0x7f, 0xf8, 0xf0, 0x37, 0xf0, 0x80, 0x07, 0x07, 0x07, 0x03, 0x0e, 0xfc, 0x07, 0x01, 0x08,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0xf0, 0x81, 0x79, 0x00, 0x9f, 0x61,
+    0x80, 0x1f, 0xf0, 0xe0, 0x33, 0x60, 0x00, 0x03, 0x07, 0x03, 0x06, 0x06, 0xfc, 0x07, 0x01, 0x08, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x08, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x03, 0x08,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0f, 0x08, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0c, 0x08, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x01, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+#endif // FONT_ATLAS_H
@@ -2,8 +2,13 @@
 #define GAME_H
 
 #include <SDL.h>
-#include <SDL_ttf.h>
+#include "alloc_tracker.h"
 #include "board.h"
+#include "evaluator.h"
+#include "search.h"
+#include "font.h"
+#include "input.h"
+#include "playfield_raster.h"
 
 enum GameState {
     MENU,
@@ -13,12 +18,21 @@ enum GameState {
 
 class Game {
 public:
-    Game();
+    // startupCounter is the performance counter value the process started at; the startup phases
+    // are printed relative to it when isStartupLogged
+    Game(Uint64 startupCounter, bool isStartupLogged);
     ~Game();
     void run();
+    void setInputDelays(Uint32 dasMs, Uint32 arrMs);
+    bool loadEvaluatorWeights(const char *path);
+    int runAllocationCheck(int frames);
+    void setRasterPlayfield(bool enabled);
 
 private:
+    void step();
     void processInput();
+    void applyGravity(Uint32 until);
+    void applyAction(InputAction action, Uint32 timestamp);
     void update();
     void render();
     void renderScore();
@@ -29,6 +43,8 @@ private:
     void handleRestartButtonClick(int mouseX, int mouseY);
     void handlePauseButtonClick(int mouseX, int mouseY);
     void handleMenuButtonClick(int mouseX, int mouseY);
+    void drawCenteredText(const char *text, const SDL_Rect &rect);
+    void logStartupPhase(const char *phase);
 
     SDL_Window *window;
     SDL_Renderer *renderer;
@@ -37,7 +53,17 @@ private:
     const Uint32 tickInterval;
 
     Board board;
-    TTF_Font *font;
+    NeuralEvaluator neuralEvaluator;
+    SearchContext searchContext;
+    Font font;
+    Input input;
+    PlayfieldRaster playfieldRaster; // Used instead of Board::draw once created
+
+    Uint64 startupCounter;  // Performance counter value when the process started
+    bool isStartupLogged;
+    bool firstFramePresented;
+    Uint64 frameCount;
+    Uint64 lastFrameAllocations; // Heap allocations plus SDL objects created by the last step()
 
     SDL_Rect restartButtonRect;
     SDL_Rect pauseButtonRect;
@@ -0,0 +1,68 @@
+#ifndef INPUT_H
+#define INPUT_H
+
+#include <SDL.h>
+
+const Uint32 DEFAULT_DAS_MS = 167; // Delayed auto shift: how long a key is held before it repeats
+const Uint32 DEFAULT_ARR_MS = 33;  // Auto repeat rate: time between repeats once DAS has elapsed
+const int INPUT_QUEUE_SIZE = 64;
+
+enum InputAction {
+    MOVE_LEFT,
+    MOVE_RIGHT,
+    SOFT_DROP,
+    ROTATE,
+    HARD_DROP
+};
+
+// Number of gravity ticks of tickInterval due by until, advancing lastTick past them. A backlog of
+// more than one tick, after a pause or a stalled frame, is dropped rather than returned at once.
+int dueGravityTicks(Uint32 until, Uint32 tickInterval, Uint32 &lastTick);
+
+// Turns SDL key events into game actions. Held keys repeat on SDL event timestamps rather than on
+// OS key repeat or frame boundaries, so repeats land on the millisecond they are due.
+class Input {
+public:
+    Input();
+    void setDelays(Uint32 dasMs, Uint32 arrMs);
+    void handleKeyEvent(const SDL_KeyboardEvent &key);
+    bool nextAction(Uint32 now, InputAction &action, Uint32 &timestamp);
+    void actionApplied(Uint32 timestamp); // Only applied actions count towards latency
+    Uint32 msUntilNextRepeat(Uint32 now) const;
+    void framePresented(Uint32 presentTime);
+    void reportLatency() const;
+
+private:
+    struct QueuedAction {
+        InputAction action;
+        Uint32 timestamp;
+    };
+
+    struct RepeatKey {
+        bool held;
+        Uint32 nextRepeat;
+    };
+
+    void queueAction(InputAction action, Uint32 timestamp);
+    void queueRepeats(Uint32 until);
+    int activeHorizontalKey() const;
+    int nextRepeatKey() const;
+
+    Uint32 das;
+    Uint32 arr;
+    RepeatKey repeatKeys[3];    // Indexed by MOVE_LEFT, MOVE_RIGHT, SOFT_DROP
+    int lastHorizontalKey;      // MOVE_LEFT or MOVE_RIGHT, whichever was pressed last
+
+    QueuedAction queue[INPUT_QUEUE_SIZE];
+    int queueHead;
+    int queueCount;
+
+    // Input-to-present latency, measured from the oldest action applied since the last present
+    bool hasUnpresentedAction;
+    Uint32 unpresentedTimestamp;
+    Uint32 latencySamples;
+    Uint64 latencyTotalMs;
+    Uint32 latencyMaxMs;
+};
+
+#endif // INPUT_H
@@ -0,0 +1,29 @@
+#ifndef PLAYFIELD_RASTER_H
+#define PLAYFIELD_RASTER_H
+
+#include "board.h"
+
+const int PLAYFIELD_PIXEL_WIDTH = BOARD_WIDTH * BLOCK_SIZE + 1; // Plus the right boundary line
+const int PLAYFIELD_PIXEL_HEIGHT = BOARD_HEIGHT * BLOCK_SIZE;
+
+// Alternative to Board::draw for SDL's software renderer: the playfield is span-filled straight
+// into a streaming texture, re-rasterizing only rows whose cells changed, and reaches the screen
+// with a single SDL_RenderCopy per frame.
+class PlayfieldRaster {
+public:
+    PlayfieldRaster();
+    bool create(SDL_Renderer *renderer);
+    void destroy();
+    bool isCreated() const;
+    void draw(SDL_Renderer *renderer, const Board &board);
+
+private:
+    void rasterizeRows(Uint32 *pixels, int pitch, int firstRow, int lastRow);
+
+    SDL_Texture *texture;
+    Uint32 cells[BOARD_HEIGHT][BOARD_WIDTH];       // ARGB8888 colors for the frame being drawn
+    Uint32 drawnCells[BOARD_HEIGHT][BOARD_WIDTH];  // Colors currently in the texture
+    bool needsFullRedraw;
+};
+
+#endif // PLAYFIELD_RASTER_H
@@ -0,0 +1,37 @@
+#ifndef SEARCH_H
+#define SEARCH_H
+
+#include "evaluator.h"
+
+// Scratch state of the AI search: piece shapes, the deadline and the evaluator leaf batch. Kept
+// out of Board so boards stay small and cheap to copy; the caller owns one per searching thread.
+class SearchContext {
+public:
+    SearchContext();
+    void setEvaluator(Evaluator *evaluator); // nullptr selects the built-in linear evaluator
+    void setMaxDepth(int depth);             // Deepest iteration searched, AI_MAX_SEARCH_DEPTH by default
+    void search(const BitBoard &root, const Piece &currentPiece, double budgetMs, int &bestX, int &bestRotation);
+    int getLastSearchDepth() const; // Unknown pieces looked ahead by the last completed iteration
+
+private:
+    double expectimax(const BitBoard &board, int depth, int linesCleared);
+    double bestPlacementValue(const BitBoard &board, const ShapeMask (*rotations)[BOARD_WIDTH], int depth, int linesCleared, int firstPlacement, int *bestPlacement);
+    int gatherPlacements(const BitBoard &board, const ShapeMask (*rotations)[BOARD_WIDTH], int linesCleared, int offset);
+    void evaluateLeaves(int count);
+    bool isSearchOutOfTime();
+
+    Evaluator *evaluator;
+    ShapeMask shapes[7][4][BOARD_WIDTH]; // Per piece type, rotation and column, filled by search
+    ShapeMask currentShapes[4][BOARD_WIDTH];
+    int maxDepth;
+    Uint64 searchDeadline;
+    bool searchTimedOut;
+    int lastSearchDepth;
+
+    // Leaf positions collected for one evaluator batch
+    BoardFeatures leafFeatures[MAX_EVAL_BATCH];
+    float leafValues[MAX_EVAL_BATCH];
+    int leafPlacements[MAX_EVAL_BATCH]; // rotation * BOARD_WIDTH + x
+};
+
+#endif // SEARCH_H
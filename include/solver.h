@@ -0,0 +1,56 @@
+#ifndef SOLVER_H
+#define SOLVER_H
+
+#include <vector>
+#include "board.h"
+
+enum PuzzleGoal {
+    CLEAR_LINES,
+    PERFECT_CLEAR
+};
+
+struct Puzzle {
+    Board board;
+    std::vector<TetrominoType> pieces; // Must be placed in this order
+    PuzzleGoal goal;
+    int targetLines;                   // For CLEAR_LINES
+};
+
+// One placement, in the same terms as Board::bestMove: rotations from spawn, then the column
+struct SolutionStep {
+    TetrominoType type;
+    int rotation;
+    int x;
+};
+
+struct SolveResult {
+    bool solved;
+    std::vector<SolutionStep> steps;
+    Uint64 nodes;
+    double seconds;
+};
+
+struct PuzzleMemoEntry;
+
+// Transposition table of states that failed to reach the goal. Allocated on first use and reused
+// by later solvePuzzle calls; entries from earlier calls are told apart by a generation number.
+class PuzzleMemo {
+public:
+    PuzzleMemo();
+    ~PuzzleMemo();
+
+private:
+    PuzzleMemo(const PuzzleMemo &) = delete;
+    PuzzleMemo &operator=(const PuzzleMemo &) = delete;
+
+    PuzzleMemoEntry *entries;
+    Uint64 generation;
+
+    friend SolveResult solvePuzzle(const Puzzle &puzzle, int threadCount, PuzzleMemo &memo);
+};
+
+bool loadPuzzle(const char *path, Puzzle &puzzle);
+SolveResult solvePuzzle(const Puzzle &puzzle, int threadCount, PuzzleMemo &memo);
+int runSolver(const char *path);
+
+#endif // SOLVER_H
@@ -0,0 +1,111 @@
+#ifndef TETRIS_ENV_H
+#define TETRIS_ENV_H
+
+#include <stdint.h>
+
+/*
+ * Vectorized training environment: steps N independent boards per call.
+ *
+ * An action places the current piece: action = rotation * TETRIS_ENV_BOARD_WIDTH + x, the same
+ * encoding Board::bestMove produces. The piece is rotated, shifted towards column x as far as it
+ * can go and hard dropped, as Board::placePiece does.
+ *
+ * All results live in one contiguous block owned by the environment and never move, so callers
+ * can wrap them once (e.g. as numpy arrays) and read them after every step without copying:
+ *   observations  uint8[count][TETRIS_ENV_OBS_SIZE]  row-major cells (0/1), then the piece type
+ *   rewards       float[count]                        score gained by the step
+ *   dones         uint8[count]                        1 if the board topped out; it has already
+ *                                                     been reset and its observation is the new board
+ *
+ * Every board draws its pieces from its own generator, seeded from the env's seed, so envs
+ * created with the same seed play the same sequences regardless of anything else in the process.
+ */
+
+#define TETRIS_ENV_BOARD_WIDTH 10
+#define TETRIS_ENV_BOARD_HEIGHT 20
+#define TETRIS_ENV_ACTION_COUNT (4 * TETRIS_ENV_BOARD_WIDTH)
+#define TETRIS_ENV_OBS_SIZE (TETRIS_ENV_BOARD_WIDTH * TETRIS_ENV_BOARD_HEIGHT + 1)
+
+#define TETRIS_ENV_MAGIC 0x54454e56u /* "TENV" */
+#define TETRIS_ENV_VERSION 2u
+
+#if defined(_WIN32) && defined(TETRIS_ENV_BUILD)
+#define TETRIS_ENV_API __declspec(dllexport)
+#elif defined(_WIN32)
+#define TETRIS_ENV_API __declspec(dllimport)
+#else
+#define TETRIS_ENV_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum TetrisEnvCommand {
+    TETRIS_ENV_STEP = 0,
+    TETRIS_ENV_RESET = 1,
+    TETRIS_ENV_SHUTDOWN = 2
+};
+
+/*
+ * Start of the block. Offsets are in bytes from the start of the header and 64-byte aligned.
+ *
+ * Shared-memory protocol, see tetris_env_post for the client side: the client writes actions and
+ * command, then increments request with a release store and wakes the server. The server runs
+ * the command, release-stores response = request and wakes the client. request and response are
+ * only accessed atomically. A waiting side spins briefly, then blocks on a futex on Linux or
+ * backs off with short sleeps elsewhere.
+ */
+typedef struct TetrisEnvHeader {
+    uint32_t magic;
+    uint32_t version;
+    int32_t count;
+    int32_t observationSize;
+    uint32_t actionsOffset;
+    uint32_t observationsOffset;
+    uint32_t rewardsOffset;
+    uint32_t donesOffset;
+    uint32_t totalSize;
+    int32_t command;
+    uint32_t request;
+    uint32_t response;
+} TetrisEnvHeader;
+
+typedef struct TetrisEnvBuffers {
+    int32_t *actions;
+    uint8_t *observations;
+    float *rewards;
+    uint8_t *dones;
+} TetrisEnvBuffers;
+
+typedef struct TetrisEnv TetrisEnv;
+
+/* Creates count boards with results in process memory. Returns NULL on failure. */
+TETRIS_ENV_API TetrisEnv *tetris_env_create(int32_t count, uint32_t seed);
+
+/* Same, with the block placed in a named shared-memory segment for tetris_env_serve. */
+TETRIS_ENV_API TetrisEnv *tetris_env_create_shared(const char *name, int32_t count, uint32_t seed);
+
+TETRIS_ENV_API void tetris_env_destroy(TetrisEnv *env);
+
+TETRIS_ENV_API TetrisEnvBuffers tetris_env_buffers(TetrisEnv *env);
+
+/* Resets every board and writes fresh observations; rewards and dones are cleared. */
+TETRIS_ENV_API void tetris_env_reset(TetrisEnv *env);
+
+/* Applies actions[i] to board i. actions may be the env's own actions buffer. */
+TETRIS_ENV_API void tetris_env_step(TetrisEnv *env, const int32_t *actions);
+
+/* Runs commands posted through the shared header until TETRIS_ENV_SHUTDOWN. Returns 0 on a clean
+   shutdown, -1 if env is not shared. */
+TETRIS_ENV_API int tetris_env_serve(TetrisEnv *env);
+
+/* Client side of the shared-memory protocol, for a block mapped by another process: posts
+   command and blocks until the server has run it. */
+TETRIS_ENV_API void tetris_env_post(TetrisEnvHeader *header, int32_t command);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TETRIS_ENV_H */
@@ -0,0 +1,162 @@
+#include "alloc_tracker.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+#ifdef TRACK_ALLOCATIONS
+
+static std::atomic<Uint64> heapAllocations(0);
+static std::atomic<Uint64> sdlObjects(0);
+static std::atomic<Uint64> sdlObjectsFreed(0);
+
+void countSdlObject() {
+    sdlObjects.fetch_add(1, std::memory_order_relaxed);
+}
+
+void countSdlObjectFreed() {
+    sdlObjectsFreed.fetch_add(1, std::memory_order_relaxed);
+}
+
+AllocationCounts allocationCounts() {
+    return {heapAllocations.load(std::memory_order_relaxed), sdlObjects.load(std::memory_order_relaxed),
+            sdlObjectsFreed.load(std::memory_order_relaxed)};
+}
+
+// Every replaceable new and delete is replaced below. The library versions of the nothrow and
+// aligned forms do not reliably go through the plain ones (libstdc++ allocates aligned memory with
+// aligned_alloc, for one), so leaving any of them out would let allocations go uncounted.
+
+static void *countedAllocate(std::size_t size) {
+    heapAllocations.fetch_add(1, std::memory_order_relaxed);
+    return malloc(size != 0 ? size : 1);
+}
+
+static void *countedAllocateAligned(std::size_t size, std::align_val_t alignment) {
+    heapAllocations.fetch_add(1, std::memory_order_relaxed);
+    std::size_t align = static_cast<std::size_t>(alignment);
+#ifdef _WIN32
+    return _aligned_malloc(size != 0 ? size : 1, align);
+#else
+    // aligned_alloc wants a size that is a nonzero multiple of the alignment
+    std::size_t rounded = size == 0 ? align : (size + align - 1) / align * align;
+    return aligned_alloc(align, rounded);
+#endif
+}
+
+static void freeAligned(void *p) {
+#ifdef _WIN32
+    _aligned_free(p);
+#else
+    free(p);
+#endif
+}
+
+void *operator new(std::size_t size) {
+    void *p = countedAllocate(size);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void *operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept {
+    return countedAllocate(size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept {
+    return countedAllocate(size);
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment) {
+    void *p = countedAllocateAligned(size, alignment);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment) {
+    return operator new(size, alignment);
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept {
+    return countedAllocateAligned(size, alignment);
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept {
+    return countedAllocateAligned(size, alignment);
+}
+
+void operator delete(void *p) noexcept {
+    free(p);
+}
+
+void operator delete[](void *p) noexcept {
+    free(p);
+}
+
+void operator delete(void *p, const std::nothrow_t &) noexcept {
+    free(p);
+}
+
+void operator delete[](void *p, const std::nothrow_t &) noexcept {
+    free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept {
+    free(p);
+}
+
+void operator delete[](void *p, std::size_t) noexcept {
+    free(p);
+}
+
+void operator delete(void *p, std::align_val_t) noexcept {
+    freeAligned(p);
+}
+
+void operator delete[](void *p, std::align_val_t) noexcept {
+    freeAligned(p);
+}
+
+void operator delete(void *p, std::align_val_t, const std::nothrow_t &) noexcept {
+    freeAligned(p);
+}
+
+void operator delete[](void *p, std::align_val_t, const std::nothrow_t &) noexcept {
+    freeAligned(p);
+}
+
+void operator delete(void *p, std::size_t, std::align_val_t) noexcept {
+    freeAligned(p);
+}
+
+void operator delete[](void *p, std::size_t, std::align_val_t) noexcept {
+    freeAligned(p);
+}
+
+#else
+
+AllocationCounts allocationCounts() {
+    return {0, 0, 0};
+}
+
+#endif
+
+Uint64 allocationsSince(const AllocationCounts &before) {
+    AllocationCounts now = allocationCounts();
+    return (now.heap - before.heap) + (now.sdlObjects - before.sdlObjects);
+}
+
+Uint64 liveSdlObjects() {
+    AllocationCounts now = allocationCounts();
+    return now.sdlObjects - now.sdlObjectsFreed;
+}
@@ -0,0 +1,112 @@
+#include "bitboard.h"
+#include <algorithm>
+#include <climits>
+
+static bool isSameCells(const ShapeMask &a, const ShapeMask &b) {
+    if (a.rowCount != b.rowCount || a.dy[0] != b.dy[0]) {
+        return false;
+    }
+    for (int k = 0; k < a.rowCount; ++k) {
+        if (a.masks[k] != b.masks[k]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void buildShapeMasks(Piece piece, ShapeMask (*masks)[BOARD_WIDTH]) {
+    for (int rotation = 0; rotation < 4; ++rotation) {
+        int minX = INT_MAX, maxX = INT_MIN, minY = INT_MAX, maxY = INT_MIN;
+        for (int i = 0; i < 4; ++i) {
+            minX = std::min(minX, piece.blocks[i].x);
+            maxX = std::max(maxX, piece.blocks[i].x);
+            minY = std::min(minY, piece.blocks[i].y);
+            maxY = std::max(maxY, piece.blocks[i].y);
+        }
+        for (int x = 0; x < BOARD_WIDTH; ++x) {
+            ShapeMask &shape = masks[rotation][x];
+            shape.valid = x + minX >= 0 && x + maxX < BOARD_WIDTH;
+            shape.rowCount = maxY - minY + 1;
+            for (int k = 0; k < shape.rowCount; ++k) {
+                shape.dy[k] = minY + k;
+                shape.masks[k] = 0;
+            }
+            if (!shape.valid) {
+                continue;
+            }
+            for (int i = 0; i < 4; ++i) {
+                shape.masks[piece.blocks[i].y - minY] |= static_cast<Row>(1 << (x + piece.blocks[i].x));
+            }
+            // Symmetric pieces reach the same cells from several rotations; keep only the first
+            for (int earlier = 0; earlier < rotation && shape.valid; ++earlier) {
+                for (int earlierX = 0; earlierX < BOARD_WIDTH; ++earlierX) {
+                    if (masks[earlier][earlierX].valid && isSameCells(masks[earlier][earlierX], shape)) {
+                        shape.valid = false;
+                        break;
+                    }
+                }
+            }
+        }
+        piece.rotate();
+    }
+}
+
+static bool isMaskFit(const BitBoard &board, const ShapeMask &shape, int y) {
+    for (int k = 0; k < shape.rowCount; ++k) {
+        int row = y + shape.dy[k];
+        if (row >= BOARD_HEIGHT) {
+            return false;
+        }
+        if (row >= 0 && (board.rows[row] & shape.masks[k])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int placeMask(BitBoard &board, const ShapeMask &shape) {
+    if (!shape.valid || !isMaskFit(board, shape, 0)) {
+        return -1;
+    }
+    // Rows above the stack are empty, so the shape falls freely until its bottom row reaches it
+    int top = 0;
+    while (top < BOARD_HEIGHT && board.rows[top] == 0) {
+        top++;
+    }
+    int y = std::max(0, top - 1 - shape.dy[shape.rowCount - 1]);
+    while (isMaskFit(board, shape, y + 1)) {
+        y++;
+    }
+    bool isAnyLineFull = false;
+    for (int k = 0; k < shape.rowCount; ++k) {
+        int row = y + shape.dy[k];
+        if (row >= 0) {
+            board.rows[row] |= shape.masks[k];
+            isAnyLineFull = isAnyLineFull || board.rows[row] == FULL_ROW;
+        }
+    }
+    return isAnyLineFull ? clearFullRows(board) : 0;
+}
+
+int clearFullRows(BitBoard &board) {
+    int write = BOARD_HEIGHT - 1;
+    for (int read = BOARD_HEIGHT - 1; read >= 0; --read) {
+        if (board.rows[read] != FULL_ROW) {
+            board.rows[write--] = board.rows[read];
+        }
+    }
+    int cleared = write + 1;
+    for (; write >= 0; --write) {
+        board.rows[write] = 0;
+    }
+    return cleared;
+}
+
+int popCount(Row row) {
+    int count = 0;
+    while (row != 0) {
+        row &= row - 1;
+        count++;
+    }
+    return count;
+}
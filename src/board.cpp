@@ -1,9 +1,14 @@
 #include "board.h"
+#include "search.h"
 #include <cstring>
 #include <algorithm>
 #include <climits>
 
-Board::Board() : isPieceLocked(false), score(0), gameOver(false) {
+// Boards without an explicit seed draw theirs from rand(), so srand still controls the game
+Board::Board() : Board(static_cast<Uint32>(rand())) {
+}
+
+Board::Board(Uint32 seed) : isPieceLocked(false), score(0), gameOver(false), random(seed) {
     for (int y = 0; y < BOARD_HEIGHT; ++y) {
         for (int x = 0; x < BOARD_WIDTH; ++x) {
             grid[y][x].filled = false;
@@ -38,8 +43,8 @@ void Board::draw(SDL_Renderer *renderer) {
 
 
 void Board::spawnPiece() {
-    currentPiece.setType(static_cast<TetrominoType>(rand() % 7));
-    currentPiece.setColor(static_cast<TetrominoColor>(rand() % 6));
+    currentPiece.setType(static_cast<TetrominoType>(random() % 7));
+    currentPiece.setColor(static_cast<TetrominoColor>(random() % 6));
     currentPiece.position = {BOARD_WIDTH / 2, -2}; // Initially place the piece higher
 
     // Check for game over condition
@@ -95,6 +100,27 @@ void Board::rotatePiece() {
     }
 }
 
+// The placement a bestMove result and a training env action stand for
+void Board::placePiece(int x, int rotation) {
+    for (int r = 0; r < rotation; ++r) {
+        rotatePiece();
+    }
+    // Shift until the target column or a wall/stack is reached
+    int currentX = currentPiece.position.x;
+    while (currentX != x) {
+        if (currentX < x) {
+            movePieceRight();
+        } else {
+            movePieceLeft();
+        }
+        if (currentPiece.position.x == currentX) {
+            break;
+        }
+        currentX = currentPiece.position.x;
+    }
+    dropPiece();
+}
+
 bool Board::isPieceFit(const Piece &piece, int x, int y) {
     for (int i = 0; i < 4; ++i) {
         int newX = piece.blocks[i].x + x;
@@ -177,113 +203,35 @@ bool Board::isGameOver() const {
     return gameOver;
 }
 
-int Board::evaluateBoard() {
-    int numHoles = countHoles();
-    int totalHeight = aggregateHeight();
-    int totalBumpiness = bumpiness();
-    int clearedLines = getScore();
-
-    return -0.5 * totalHeight + 0.76 * clearedLines - 0.35 * numHoles - 0.18 * totalBumpiness;
+bool Board::isCellFilled(int x, int y) const {
+    return grid[y][x].filled;
 }
 
-int Board::countHoles() {
-    int holes = 0;
-    for (int x = 0; x < BOARD_WIDTH; ++x) {
-        bool blockFound = false;
-        for (int y = 0; y < BOARD_HEIGHT; ++y) {
-            if (grid[y][x].filled) {
-                blockFound = true;
-            } else if (blockFound && !grid[y][x].filled) {
-                holes++;
-            }
-        }
-    }
-    return holes;
+const Cell &Board::getCell(int x, int y) const {
+    return grid[y][x];
 }
 
-int Board::aggregateHeight() {
-    int height = 0;
-    for (int x = 0; x < BOARD_WIDTH; ++x) {
-        for (int y = 0; y < BOARD_HEIGHT; ++y) {
-            if (grid[y][x].filled) {
-                height += BOARD_HEIGHT - y;
-                break;
-            }
-        }
-    }
-    return height;
+void Board::setCellFilled(int x, int y, bool filled) {
+    grid[y][x].filled = filled;
+    Uint8 shade = filled ? 128 : 0;
+    grid[y][x].color[0] = shade;
+    grid[y][x].color[1] = shade;
+    grid[y][x].color[2] = shade;
 }
 
-int Board::bumpiness() {
-    int bumpiness = 0;
-    int previousHeight = 0;
-
-    for (int x = 0; x < BOARD_WIDTH; ++x) {
-        int currentHeight = 0;
-        for (int y = 0; y < BOARD_HEIGHT; ++y) {
-            if (grid[y][x].filled) {
-                currentHeight = BOARD_HEIGHT - y;
-                break;
-            }
-        }
-        if (x > 0) {
-            bumpiness += abs(currentHeight - previousHeight);
-        }
-        previousHeight = currentHeight;
-    }
-
-    return bumpiness;
-}
-
-void Board::bestMove(int& bestX, int& bestRotation) {
-    int bestScore = INT_MIN;
-
-    for (int rotation = 0; rotation < 4; ++rotation) {
+void Board::bestMove(int& bestX, int& bestRotation, SearchContext &context, double budgetMs) {
+    BitBoard root;
+    for (int y = 0; y < BOARD_HEIGHT; ++y) {
+        root.rows[y] = 0;
         for (int x = 0; x < BOARD_WIDTH; ++x) {
-            Piece testPiece = currentPiece;
-            testPiece.position.x = x;
-
-            for (int r = 0; r < rotation; ++r) {
-                testPiece.rotate();
-            }
-
-            if (isPieceFit(testPiece, x, 0)) {
-                int y = 0;
-                while (isPieceFit(testPiece, x, y + 1)) {
-                    y++;
-                }
-                testPiece.position.y = y;
-
-                // Simulate placing the piece
-                for (int i = 0; i < 4; ++i) {
-                    int px = testPiece.blocks[i].x + testPiece.position.x;
-                    int py = testPiece.blocks[i].y + testPiece.position.y;
-                    if (py >= 0) {
-                        grid[py][px].filled = true;
-                    }
-                }
-
-                int score = evaluateBoard();
-
-                // Undo the placing of the piece
-                for (int i = 0; i < 4; ++i) {
-                    int px = testPiece.blocks[i].x + testPiece.position.x;
-                    int py = testPiece.blocks[i].y + testPiece.position.y;
-                    if (py >= 0) {
-                        grid[py][px].filled = false;
-                    }
-                }
-
-                if (score > bestScore) {
-                    bestScore = score;
-                    bestX = x;
-                    bestRotation = rotation;
-                }
+            if (grid[y][x].filled) {
+                root.rows[y] |= static_cast<Row>(1 << x);
             }
         }
     }
+    context.search(root, currentPiece, budgetMs, bestX, bestRotation);
 }
 
-Piece Board::getCurrentPiece() const {
+const Piece &Board::getCurrentPiece() const {
     return currentPiece;
 }
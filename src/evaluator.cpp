@@ -0,0 +1,167 @@
+#include "evaluator.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define EVALUATOR_SSE 1
+#endif
+
+// Spreads five column bits over the low five bytes of a word, bit x into byte x, so that byte
+// counters for five columns advance with a single add
+static Uint64 spreadColumns(Uint64 columns) {
+    return (columns * 0x10204081ULL) & 0x0101010101ULL;
+}
+
+// A column's height is the number of rows at or below its top cell, and its holes are the empty
+// cells among those. Both are counted for all columns at once, one row at a time.
+void extractFeatures(const BitBoard &board, int linesCleared, BoardFeatures &features) {
+    Uint64 heights[2] = {0, 0}; // Byte counters for columns 0-4 and 5-9
+    Uint64 holes[2] = {0, 0};
+    int y = 0;
+    while (y < BOARD_HEIGHT && board.rows[y] == 0) {
+        y++;
+    }
+    Row covered = 0; // Columns with a filled cell at or above the current row
+    for (; y < BOARD_HEIGHT; ++y) {
+        covered |= board.rows[y];
+        Row empty = covered & ~board.rows[y];
+        heights[0] += spreadColumns(covered & 31);
+        heights[1] += spreadColumns(covered >> 5);
+        holes[0] += spreadColumns(empty & 31);
+        holes[1] += spreadColumns(empty >> 5);
+    }
+    for (int x = 0; x < BOARD_WIDTH; ++x) {
+        int shift = 8 * (x % 5);
+        features.values[x] = static_cast<float>(heights[x / 5] >> shift & 0xFF);
+        features.values[BOARD_WIDTH + x] = static_cast<float>(holes[x / 5] >> shift & 0xFF);
+    }
+    features.values[2 * BOARD_WIDTH] = static_cast<float>(linesCleared);
+}
+
+void LinearEvaluator::evaluate(const BoardFeatures *features, int count, float *values) {
+    for (int b = 0; b < count; ++b) {
+        const float *f = features[b].values;
+        float totalHeight = 0;
+        float holes = 0;
+        float totalBumpiness = 0;
+        for (int x = 0; x < BOARD_WIDTH; ++x) {
+            totalHeight += f[x];
+            holes += f[BOARD_WIDTH + x];
+            if (x > 0) {
+                totalBumpiness += std::abs(f[x] - f[x - 1]);
+            }
+        }
+        values[b] = -0.5f * totalHeight + 0.76f * f[2 * BOARD_WIDTH] - 0.35f * holes - 0.18f * totalBumpiness;
+    }
+}
+
+NeuralEvaluator::NeuralEvaluator() : hiddenCount(0), outputBias(0) {
+}
+
+bool NeuralEvaluator::isLoaded() const {
+    return hiddenCount > 0;
+}
+
+// Text format: a header "mlp <inputs> <hidden>", followed by the hidden weights (row per hidden
+// unit), the hidden biases, the output weights and the output bias, whitespace separated.
+// Lines starting with '#' are comments.
+bool NeuralEvaluator::load(const char *path) {
+    std::ifstream file(path);
+    if (!file) {
+        std::cerr << "NeuralEvaluator: cannot open " << path << std::endl;
+        return false;
+    }
+
+    std::string content;
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] != '#') {
+            content += line;
+            content += ' ';
+        }
+    }
+
+    std::istringstream stream(content);
+    std::string tag;
+    int inputCount = 0;
+    int hidden = 0;
+    stream >> tag >> inputCount >> hidden;
+    if (tag != "mlp") {
+        std::cerr << "NeuralEvaluator: " << path << " is not an mlp weights file" << std::endl;
+        return false;
+    }
+    if (inputCount != FEATURE_COUNT || hidden <= 0) {
+        std::cerr << "NeuralEvaluator: expected " << FEATURE_COUNT << " inputs and at least one hidden unit in " << path << std::endl;
+        return false;
+    }
+
+    std::vector<float> numbers;
+    size_t expected = hidden * FEATURE_COUNT + hidden + hidden + 1;
+    float value;
+    while (numbers.size() < expected && stream >> value) {
+        numbers.push_back(value);
+    }
+    if (numbers.size() < expected) {
+        std::cerr << "NeuralEvaluator: " << path << " has " << numbers.size() << " weights, expected " << expected << std::endl;
+        return false;
+    }
+
+    hiddenCount = hidden;
+    hiddenWeights.assign(numbers.begin(), numbers.begin() + hidden * FEATURE_COUNT);
+    hiddenBiases.assign(numbers.begin() + hidden * FEATURE_COUNT, numbers.begin() + hidden * FEATURE_COUNT + hidden);
+    outputWeights.assign(numbers.begin() + hidden * FEATURE_COUNT + hidden, numbers.end() - 1);
+    outputBias = numbers.back();
+    inputs.assign(FEATURE_COUNT * MAX_EVAL_BATCH, 0.0f);
+    return true;
+}
+
+void NeuralEvaluator::evaluate(const BoardFeatures *features, int count, float *values) {
+    if (!isLoaded()) {
+        fallback.evaluate(features, count, values);
+        return;
+    }
+    for (int start = 0; start < count; start += MAX_EVAL_BATCH) {
+        int batch = std::min(count - start, MAX_EVAL_BATCH);
+
+        // Transpose so each input feature is contiguous across the batch
+        for (int b = 0; b < batch; ++b) {
+            for (int i = 0; i < FEATURE_COUNT; ++i) {
+                inputs[i * MAX_EVAL_BATCH + b] = features[start + b].values[i];
+            }
+        }
+
+        int b = 0;
+#ifdef EVALUATOR_SSE
+        for (; b + 4 <= batch; b += 4) {
+            __m128 out = _mm_set1_ps(outputBias);
+            for (int h = 0; h < hiddenCount; ++h) {
+                const float *weights = &hiddenWeights[h * FEATURE_COUNT];
+                __m128 acc = _mm_set1_ps(hiddenBiases[h]);
+                for (int i = 0; i < FEATURE_COUNT; ++i) {
+                    acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(weights[i]), _mm_loadu_ps(&inputs[i * MAX_EVAL_BATCH + b])));
+                }
+                acc = _mm_max_ps(acc, _mm_setzero_ps());
+                out = _mm_add_ps(out, _mm_mul_ps(_mm_set1_ps(outputWeights[h]), acc));
+            }
+            _mm_storeu_ps(&values[start + b], out);
+        }
+#endif
+        for (; b < batch; ++b) {
+            float out = outputBias;
+            for (int h = 0; h < hiddenCount; ++h) {
+                const float *weights = &hiddenWeights[h * FEATURE_COUNT];
+                float acc = hiddenBiases[h];
+                for (int i = 0; i < FEATURE_COUNT; ++i) {
+                    acc += weights[i] * inputs[i * MAX_EVAL_BATCH + b];
+                }
+                out += outputWeights[h] * std::max(acc, 0.0f);
+            }
+            values[start + b] = out;
+        }
+    }
+}
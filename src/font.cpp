@@ -0,0 +1,184 @@
+#include "font.h"
+#include "font_atlas.h"
+#include "alloc_tracker.h"
+#include <iostream>
+#include <string>
+#include <vector>
+
+// SDL_ttf is only needed for text the atlas does not cover, so it is loaded on first use instead
+// of being linked into the game
+#if defined(_WIN32)
+static const char *TTF_LIBRARY_NAMES[] = {"SDL2_ttf.dll"};
+#elif defined(__APPLE__)
+static const char *TTF_LIBRARY_NAMES[] = {"libSDL2_ttf-2.0.0.dylib", "libSDL2_ttf.dylib"};
+#else
+static const char *TTF_LIBRARY_NAMES[] = {"libSDL2_ttf-2.0.so.0", "libSDL2_ttf.so"};
+#endif
+
+struct TrueTypeLibrary {
+    void *handle;
+    int (SDLCALL *init)();
+    void (SDLCALL *quit)();
+    TTF_Font *(SDLCALL *openFont)(const char *file, int ptsize);
+    void (SDLCALL *closeFont)(TTF_Font *font);
+    int (SDLCALL *sizeText)(TTF_Font *font, const char *text, int *w, int *h);
+    SDL_Surface *(SDLCALL *renderTextSolid)(TTF_Font *font, const char *text, SDL_Color fg);
+};
+
+static TrueTypeLibrary ttf;
+
+template <typename Function>
+static bool loadFunction(Function &function, const char *name) {
+    function = reinterpret_cast<Function>(SDL_LoadFunction(ttf.handle, name));
+    return function != nullptr;
+}
+
+static bool loadTrueTypeLibrary() {
+    for (const char *name : TTF_LIBRARY_NAMES) {
+        ttf.handle = SDL_LoadObject(name);
+        if (ttf.handle != nullptr) {
+            break;
+        }
+    }
+    if (ttf.handle == nullptr) {
+        std::cerr << "SDL_LoadObject Error: " << SDL_GetError() << std::endl;
+        return false;
+    }
+    if (!loadFunction(ttf.init, "TTF_Init") || !loadFunction(ttf.quit, "TTF_Quit") ||
+        !loadFunction(ttf.openFont, "TTF_OpenFont") || !loadFunction(ttf.closeFont, "TTF_CloseFont") ||
+        !loadFunction(ttf.sizeText, "TTF_SizeText") || !loadFunction(ttf.renderTextSolid, "TTF_RenderText_Solid")) {
+        std::cerr << "SDL_LoadFunction Error: " << SDL_GetError() << std::endl;
+        SDL_UnloadObject(ttf.handle);
+        ttf.handle = nullptr;
+        return false;
+    }
+    return true;
+}
+
+static void unloadTrueTypeLibrary() {
+    SDL_UnloadObject(ttf.handle);
+    ttf.handle = nullptr;
+}
+
+Font::Font() : atlas(nullptr), ttfFont(nullptr), ttfFailed(false) {
+}
+
+bool Font::load(SDL_Renderer *renderer) {
+    atlas = trackedCreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, FONT_ATLAS_WIDTH, FONT_ATLAS_HEIGHT);
+    if (atlas == nullptr) {
+        std::cerr << "SDL_CreateTexture Error: " << SDL_GetError() << std::endl;
+        return false;
+    }
+
+    // White glyphs, tinted per draw call with the texture color mod
+    std::vector<Uint32> pixels(FONT_ATLAS_WIDTH * FONT_ATLAS_HEIGHT);
+    for (size_t i = 0; i < pixels.size(); ++i) {
+        pixels[i] = (FONT_ATLAS_INK[i / 8] >> (i % 8) & 1) ? 0xFFFFFFFF : 0x00FFFFFF;
+    }
+    SDL_UpdateTexture(atlas, NULL, pixels.data(), FONT_ATLAS_WIDTH * sizeof(Uint32));
+    SDL_SetTextureBlendMode(atlas, SDL_BLENDMODE_BLEND);
+    return true;
+}
+
+void Font::close() {
+    if (atlas != nullptr) {
+        trackedDestroyTexture(atlas);
+        atlas = nullptr;
+    }
+    if (ttfFont != nullptr) {
+        ttf.closeFont(ttfFont);
+        ttf.quit();
+        unloadTrueTypeLibrary();
+        ttfFont = nullptr;
+    }
+}
+
+bool Font::isInAtlas(const char *text) const {
+    for (const char *c = text; *c != '\0'; ++c) {
+        int index = static_cast<unsigned char>(*c) - FONT_ATLAS_FIRST_CHAR;
+        if (index < 0 || index >= FONT_ATLAS_GLYPH_COUNT) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Font::loadTrueType() {
+    if (ttfFont != nullptr) {
+        return true;
+    }
+    if (ttfFailed) {
+        return false;
+    }
+    ttfFailed = true;
+
+    if (!loadTrueTypeLibrary()) {
+        return false;
+    }
+    if (ttf.init() == -1) {
+        std::cerr << "TTF_Init Error: " << TTF_GetError() << std::endl;
+        unloadTrueTypeLibrary();
+        return false;
+    }
+
+    // Look next to the executable first so the game does not depend on the working directory
+    char *basePath = SDL_GetBasePath();
+    if (basePath != nullptr) {
+        std::string path = std::string(basePath) + "Sans.ttf";
+        SDL_free(basePath);
+        ttfFont = ttf.openFont(path.c_str(), FONT_POINT_SIZE);
+    }
+    if (ttfFont == nullptr) {
+        ttfFont = ttf.openFont("Sans.ttf", FONT_POINT_SIZE);
+    }
+    if (ttfFont == nullptr) {
+        std::cerr << "TTF_OpenFont Error: " << TTF_GetError() << std::endl;
+        ttf.quit();
+        unloadTrueTypeLibrary();
+        return false;
+    }
+
+    ttfFailed = false;
+    return true;
+}
+
+void Font::textSize(const char *text, int &w, int &h) {
+    w = 0;
+    h = FONT_ATLAS_LINE_HEIGHT;
+    if (isInAtlas(text)) {
+        for (const char *c = text; *c != '\0'; ++c) {
+            w += FONT_ATLAS_GLYPH_ADVANCE[*c - FONT_ATLAS_FIRST_CHAR];
+        }
+    } else if (loadTrueType()) {
+        ttf.sizeText(ttfFont, text, &w, &h);
+    }
+}
+
+void Font::drawText(SDL_Renderer *renderer, const char *text, int x, int y, SDL_Color color) {
+    if (isInAtlas(text)) {
+        SDL_SetTextureColorMod(atlas, color.r, color.g, color.b);
+        for (const char *c = text; *c != '\0'; ++c) {
+            int index = *c - FONT_ATLAS_FIRST_CHAR;
+            SDL_Rect src = {FONT_ATLAS_GLYPH_X[index], FONT_ATLAS_GLYPH_Y[index], FONT_ATLAS_GLYPH_W[index], FONT_ATLAS_LINE_HEIGHT};
+            SDL_Rect dst = {x, y, src.w, src.h};
+            SDL_RenderCopy(renderer, atlas, &src, &dst);
+            x += FONT_ATLAS_GLYPH_ADVANCE[index];
+        }
+        return;
+    }
+
+    if (!loadTrueType()) {
+        return;
+    }
+    countSdlObject();
+    SDL_Surface *surfaceMessage = ttf.renderTextSolid(ttfFont, text, color);
+    if (surfaceMessage == nullptr) {
+        return;
+    }
+    SDL_Texture *message = trackedCreateTextureFromSurface(renderer, surfaceMessage);
+    SDL_Rect messageRect = {x, y, surfaceMessage->w, surfaceMessage->h};
+    SDL_RenderCopy(renderer, message, NULL, &messageRect);
+
+    trackedFreeSurface(surfaceMessage);
+    trackedDestroyTexture(message);
+}
@@ -1,29 +1,15 @@
 #include "game.h"
+#include <algorithm>
+#include <cstdio>
 #include <iostream>
-#include <string>
 
-Game::Game() : window(nullptr), renderer(nullptr), isRunning(true), lastTick(0), tickInterval(500), isGameOver(false), isPaused(false), gameState(MENU) {
+Game::Game(Uint64 startupCounter, bool isStartupLogged) : window(nullptr), renderer(nullptr), isRunning(true), lastTick(0), tickInterval(500), startupCounter(startupCounter), isStartupLogged(isStartupLogged), firstFramePresented(false), frameCount(0), lastFrameAllocations(0), isGameOver(false), isPaused(false), gameState(MENU) {
     if (SDL_Init(SDL_INIT_VIDEO) != 0) {
         std::cerr << "SDL_Init Error: " << SDL_GetError() << std::endl;
         isRunning = false;
         return;
     }
-
-    if (TTF_Init() == -1) {
-        std::cerr << "TTF_Init Error: " << TTF_GetError() << std::endl;
-        SDL_Quit();
-        isRunning = false;
-        return;
-    }
-
-    font = TTF_OpenFont("Sans.ttf", 24);
-    if (font == nullptr) {
-        std::cerr << "TTF_OpenFont Error: " << TTF_GetError() << std::endl;
-        TTF_Quit();
-        SDL_Quit();
-        isRunning = false;
-        return;
-    }
+    logStartupPhase("SDL_Init");
 
     windowWidth = 800;
     windowHeight = 600;
@@ -34,8 +20,13 @@ Game::Game() : window(nullptr), renderer(nullptr), isRunning(true), lastTick(0),
         isRunning = false;
         return;
     }
+    logStartupPhase("window created");
 
     renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+    if (renderer == nullptr) {
+        // No GPU driver available (e.g. remote or headless sessions): fall back to SDL's software renderer
+        renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_SOFTWARE);
+    }
     if (renderer == nullptr) {
         SDL_DestroyWindow(window);
         std::cerr << "SDL_CreateRenderer Error: " << SDL_GetError() << std::endl;
@@ -43,6 +34,22 @@ Game::Game() : window(nullptr), renderer(nullptr), isRunning(true), lastTick(0),
         isRunning = false;
         return;
     }
+    logStartupPhase("renderer created");
+
+    if (!font.load(renderer)) {
+        SDL_DestroyRenderer(renderer);
+        SDL_DestroyWindow(window);
+        SDL_Quit();
+        isRunning = false;
+        return;
+    }
+    logStartupPhase("font atlas uploaded");
+
+    // SDL's software renderer is much faster with the playfield written as pixels
+    SDL_RendererInfo rendererInfo;
+    if (SDL_GetRendererInfo(renderer, &rendererInfo) == 0 && (rendererInfo.flags & SDL_RENDERER_SOFTWARE)) {
+        setRasterPlayfield(true);
+    }
 
     restartButtonRect = {0, 0, 200, 50};
     pauseButtonRect = {0, 0, 200, 50};
@@ -51,52 +58,111 @@ Game::Game() : window(nullptr), renderer(nullptr), isRunning(true), lastTick(0),
 }
 
 Game::~Game() {
-    TTF_CloseFont(font);
-    TTF_Quit();
+    input.reportLatency();
+    playfieldRaster.destroy();
+    font.close();
+    if (ALLOCATION_TRACKING && liveSdlObjects() > 0) {
+        std::cout << "Leaked " << liveSdlObjects() << " SDL textures/surfaces" << std::endl;
+    }
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
     SDL_Quit();
 }
 
+// Startup instrumentation, printed once per phase as milliseconds since the process started
+void Game::logStartupPhase(const char *phase) {
+    if (!isStartupLogged) {
+        return;
+    }
+    double elapsedMs = (SDL_GetPerformanceCounter() - startupCounter) * 1000.0 / SDL_GetPerformanceFrequency();
+    std::cout << "Startup: " << phase << " at " << elapsedMs << " ms" << std::endl;
+}
+
 void Game::run() {
     while (isRunning) {
-        Uint32 currentTick = SDL_GetTicks();
-        if (!isPaused && currentTick - lastTick >= tickInterval && !board.isGameOver()) {
-            board.movePieceDown();
-            lastTick = currentTick;
+        step();
+
+        // Sleep to prevent high CPU usage, but wake up as soon as input arrives or a held key repeats
+        Uint32 timeout = std::min<Uint32>(10, input.msUntilNextRepeat(SDL_GetTicks()));
+        if (timeout > 0) {
+            SDL_WaitEventTimeout(nullptr, timeout);
+        }
+    }
+}
+
+// One iteration of the game loop, without the wait
+void Game::step() {
+    AllocationCounts before = allocationCounts();
+
+    processInput();
+    update();
+    render();
+
+    frameCount++;
+    if (ALLOCATION_TRACKING) {
+        lastFrameAllocations = allocationsSince(before);
+        if (lastFrameAllocations > 0) {
+            std::cout << "Frame " << frameCount << ": " << lastFrameAllocations << " allocations" << std::endl;
         }
-        processInput();
-        update();
-        render();
-        SDL_Delay(10); // Small delay to prevent high CPU usage
     }
 }
 
+// Plays the AI for warm-up frames, then fails if any of the following frames allocates.
+// Returns the process exit code.
+int Game::runAllocationCheck(int frames) {
+    if (!ALLOCATION_TRACKING) {
+        std::cerr << "Allocation check needs a build with TRACK_ALLOCATIONS" << std::endl;
+        return 2;
+    }
+    if (!isRunning) {
+        return 2;
+    }
+
+    const int warmUpFrames = 120;
+    gameState = AI;
+    Uint64 total = 0;
+    for (int frame = 0; frame < warmUpFrames + frames && isRunning; ++frame) {
+        if (board.isGameOver()) {
+            board = Board();
+        }
+        step();
+        if (frame >= warmUpFrames) {
+            total += lastFrameAllocations;
+        }
+    }
+
+    std::cout << "Allocation check: " << total << " allocations in " << frames << " steady-state frames" << std::endl;
+    return total == 0 ? 0 : 1;
+}
+
+void Game::setRasterPlayfield(bool enabled) {
+    if (enabled && !playfieldRaster.isCreated() && renderer != nullptr) {
+        playfieldRaster.create(renderer);
+    } else if (!enabled) {
+        playfieldRaster.destroy();
+    }
+}
+
+void Game::setInputDelays(Uint32 dasMs, Uint32 arrMs) {
+    input.setDelays(dasMs, arrMs);
+}
+
+// Switches the AI to the neural evaluator; on failure it keeps the linear one
+bool Game::loadEvaluatorWeights(const char *path) {
+    if (!neuralEvaluator.load(path)) {
+        return false;
+    }
+    searchContext.setEvaluator(&neuralEvaluator);
+    return true;
+}
+
 void Game::processInput() {
     SDL_Event event;
     while (SDL_PollEvent(&event)) {
         if (event.type == SDL_QUIT) {
             isRunning = false;
-        } else if (event.type == SDL_KEYDOWN) {
-            if (gameState == PLAYER && !board.isGameOver() && !isPaused) {
-                switch (event.key.keysym.sym) {
-                    case SDLK_LEFT:
-                        board.movePieceLeft();
-                        break;
-                    case SDLK_RIGHT:
-                        board.movePieceRight();
-                        break;
-                    case SDLK_DOWN:
-                        board.movePieceDown();
-                        break;
-                    case SDLK_UP:
-                        board.rotatePiece();
-                        break;
-                    case SDLK_SPACE:
-                        board.dropPiece();
-                        break;
-                }
-            }
+        } else if (event.type == SDL_KEYDOWN || event.type == SDL_KEYUP) {
+            input.handleKeyEvent(event.key);
         } else if (event.type == SDL_MOUSEBUTTONDOWN) {
             int mouseX, mouseY;
             SDL_GetMouseState(&mouseX, &mouseY);
@@ -109,6 +175,50 @@ void Game::processInput() {
             }
         }
     }
+
+    // Always drain the queue so actions never pile up while the board is not accepting them.
+    // Gravity ticks that fell due before an action are applied first.
+    Uint32 now = SDL_GetTicks();
+    InputAction action;
+    Uint32 timestamp;
+    while (input.nextAction(now, action, timestamp)) {
+        applyGravity(timestamp);
+        if (gameState == PLAYER && !board.isGameOver() && !isPaused) {
+            applyAction(action, timestamp);
+        }
+    }
+    applyGravity(now);
+}
+
+// Applies the gravity ticks due by the given time
+void Game::applyGravity(Uint32 until) {
+    if (isPaused || board.isGameOver()) {
+        return;
+    }
+    for (int ticks = dueGravityTicks(until, tickInterval, lastTick); ticks > 0; --ticks) {
+        board.movePieceDown();
+    }
+}
+
+void Game::applyAction(InputAction action, Uint32 timestamp) {
+    input.actionApplied(timestamp);
+    switch (action) {
+        case MOVE_LEFT:
+            board.movePieceLeft();
+            break;
+        case MOVE_RIGHT:
+            board.movePieceRight();
+            break;
+        case SOFT_DROP:
+            board.movePieceDown();
+            break;
+        case ROTATE:
+            board.rotatePiece();
+            break;
+        case HARD_DROP:
+            board.dropPiece();
+            break;
+    }
 }
 
 void Game::update() {
@@ -117,11 +227,18 @@ void Game::update() {
         static bool newPiece = true;
 
         if (newPiece) {
-            board.bestMove(bestX, bestRotation);
+            AllocationCounts before = allocationCounts();
+            board.bestMove(bestX, bestRotation, searchContext);
             newPiece = false;
+            if (ALLOCATION_TRACKING) {
+                Uint64 allocations = allocationsSince(before);
+                if (allocations > 0) {
+                    std::cout << "AI move: " << allocations << " allocations" << std::endl;
+                }
+            }
         }
 
-        Piece currentPiece = board.getCurrentPiece();
+        const Piece &currentPiece = board.getCurrentPiece();
 
         if (currentPiece.position.x < bestX) {
             board.movePieceRight();
@@ -146,7 +263,11 @@ void Game::render() {
     if (gameState == MENU) {
         renderMenu();
     } else {
-        board.draw(renderer);
+        if (playfieldRaster.isCreated()) {
+            playfieldRaster.draw(renderer, board);
+        } else {
+            board.draw(renderer);
+        }
         renderScore();
 
         if (board.isGameOver()) {
@@ -158,120 +279,66 @@ void Game::render() {
     }
 
     SDL_RenderPresent(renderer);
+    input.framePresented(SDL_GetTicks());
+
+    if (!firstFramePresented) {
+        firstFramePresented = true;
+        logStartupPhase("first frame presented");
+    }
+}
+
+void Game::drawCenteredText(const char *text, const SDL_Rect &rect) {
+    int w, h;
+    font.textSize(text, w, h);
+    SDL_Color white = {255, 255, 255, 255};
+    font.drawText(renderer, text, rect.x + (rect.w - w) / 2, rect.y + (rect.h - h) / 2, white);
 }
 
 void Game::renderScore() {
-    std::string scoreText = "Score: " + std::to_string(board.getScore());
+    char scoreText[32];
+    snprintf(scoreText, sizeof(scoreText), "Score: %d", board.getScore());
     SDL_Color white = {255, 255, 255, 255};
-    SDL_Surface *surfaceMessage = TTF_RenderText_Solid(font, scoreText.c_str(), white);
-    SDL_Texture *message = SDL_CreateTextureFromSurface(renderer, surfaceMessage);
-    SDL_Rect messageRect;
-    messageRect.x = windowWidth - surfaceMessage->w - 20; // Adjusted for window width
-    messageRect.y = 10;
-    messageRect.w = surfaceMessage->w;
-    messageRect.h = surfaceMessage->h;
-    SDL_RenderCopy(renderer, message, NULL, &messageRect);
-
-    SDL_FreeSurface(surfaceMessage);
-    SDL_DestroyTexture(message);
+    int w, h;
+    font.textSize(scoreText, w, h);
+    font.drawText(renderer, scoreText, windowWidth - w - 20, 10, white); // Adjusted for window width
 }
 
 void Game::renderGameOver() {
-    std::string gameOverText = "Game Over";
+    const char *gameOverText = "Game Over";
     SDL_Color white = {255, 255, 255, 255};
-    SDL_Surface *surfaceMessage = TTF_RenderText_Solid(font, gameOverText.c_str(), white);
-    SDL_Texture *message = SDL_CreateTextureFromSurface(renderer, surfaceMessage);
-    SDL_Rect messageRect;
-    messageRect.w = surfaceMessage->w;
-    messageRect.h = surfaceMessage->h;
-    messageRect.x = (windowWidth - messageRect.w) / 64 * 49; // Center horizontally
-    messageRect.y = (windowHeight - messageRect.h) / 2 - 30; // Center vertically with offset
-    SDL_RenderCopy(renderer, message, NULL, &messageRect);
-
-    SDL_FreeSurface(surfaceMessage);
-    SDL_DestroyTexture(message);
+    int w, h;
+    font.textSize(gameOverText, w, h);
+    int x = (windowWidth - w) / 64 * 49; // Center horizontally
+    int y = (windowHeight - h) / 2 - 30; // Center vertically with offset
+    font.drawText(renderer, gameOverText, x, y, white);
 }
 
 void Game::renderRestartButton() {
-    std::string restartText = "Restart";
-    SDL_Color white = {255, 255, 255, 255};
-    SDL_Surface *surfaceMessage = TTF_RenderText_Solid(font, restartText.c_str(), white);
-    SDL_Texture *message = SDL_CreateTextureFromSurface(renderer, surfaceMessage);
-
     restartButtonRect.x = (windowWidth - restartButtonRect.w) / 4 * 3; // Center horizontally
     restartButtonRect.y = (windowHeight - restartButtonRect.h) / 2 + 20; // Center vertically with offset
 
     SDL_SetRenderDrawColor(renderer, 255, 0, 0, 255);
     SDL_RenderFillRect(renderer, &restartButtonRect);
-
-    SDL_Rect messageRect;
-    messageRect.x = restartButtonRect.x + (restartButtonRect.w - surfaceMessage->w) / 2;
-    messageRect.y = restartButtonRect.y + (restartButtonRect.h - surfaceMessage->h) / 2;
-    messageRect.w = surfaceMessage->w;
-    messageRect.h = surfaceMessage->h;
-    SDL_RenderCopy(renderer, message, NULL, &messageRect);
-
-    SDL_FreeSurface(surfaceMessage);
-    SDL_DestroyTexture(message);
+    drawCenteredText("Restart", restartButtonRect);
 }
 
 void Game::renderPauseButton() {
-    std::string pauseText = isPaused ? "Resume" : "Pause";
-    SDL_Color white = {255, 255, 255, 255};
-    SDL_Surface *surfaceMessage = TTF_RenderText_Solid(font, pauseText.c_str(), white);
-    SDL_Texture *message = SDL_CreateTextureFromSurface(renderer, surfaceMessage);
-
     pauseButtonRect.x = windowWidth - pauseButtonRect.w - 20; // Adjusted for window width
     pauseButtonRect.y = windowHeight - pauseButtonRect.h - 20; // Adjusted for window height
 
     SDL_SetRenderDrawColor(renderer, 0, 0, 255, 255);
     SDL_RenderFillRect(renderer, &pauseButtonRect);
-
-    SDL_Rect messageRect;
-    messageRect.x = pauseButtonRect.x + (pauseButtonRect.w - surfaceMessage->w) / 2;
-    messageRect.y = pauseButtonRect.y + (pauseButtonRect.h - surfaceMessage->h) / 2;
-    messageRect.w = surfaceMessage->w;
-    messageRect.h = surfaceMessage->h;
-    SDL_RenderCopy(renderer, message, NULL, &messageRect);
-
-    SDL_FreeSurface(surfaceMessage);
-    SDL_DestroyTexture(message);
+    drawCenteredText(isPaused ? "Resume" : "Pause", pauseButtonRect);
 }
 
 void Game::renderMenu() {
-    std::string playerText = "Player";
-    SDL_Color white = {255, 255, 255, 255};
-    SDL_Surface *surfaceMessage = TTF_RenderText_Solid(font, playerText.c_str(), white);
-    SDL_Texture *message = SDL_CreateTextureFromSurface(renderer, surfaceMessage);
-
     SDL_SetRenderDrawColor(renderer, 0, 255, 0, 255);
     SDL_RenderFillRect(renderer, &playerButtonRect);
-
-    SDL_Rect messageRect;
-    messageRect.x = playerButtonRect.x + (playerButtonRect.w - surfaceMessage->w) / 2;
-    messageRect.y = playerButtonRect.y + (playerButtonRect.h - surfaceMessage->h) / 2;
-    messageRect.w = surfaceMessage->w;
-    messageRect.h = surfaceMessage->h;
-    SDL_RenderCopy(renderer, message, NULL, &messageRect);
-
-    SDL_FreeSurface(surfaceMessage);
-    SDL_DestroyTexture(message);
-
-    std::string aiText = "Algorithm";
-    surfaceMessage = TTF_RenderText_Solid(font, aiText.c_str(), white);
-    message = SDL_CreateTextureFromSurface(renderer, surfaceMessage);
+    drawCenteredText("Player", playerButtonRect);
 
     SDL_SetRenderDrawColor(renderer, 0, 0, 255, 255);
     SDL_RenderFillRect(renderer, &aiButtonRect);
-
-    messageRect.x = aiButtonRect.x + (aiButtonRect.w - surfaceMessage->w) / 2;
-    messageRect.y = aiButtonRect.y + (aiButtonRect.h - surfaceMessage->h) / 2;
-    messageRect.w = surfaceMessage->w;
-    messageRect.h = surfaceMessage->h;
-    SDL_RenderCopy(renderer, message, NULL, &messageRect);
-
-    SDL_FreeSurface(surfaceMessage);
-    SDL_DestroyTexture(message);
+    drawCenteredText("Algorithm", aiButtonRect);
 }
 
 void Game::handleRestartButtonClick(int mouseX, int mouseY) {
@@ -0,0 +1,172 @@
+#include "input.h"
+#include <iostream>
+
+Input::Input() : das(DEFAULT_DAS_MS), arr(DEFAULT_ARR_MS), lastHorizontalKey(MOVE_LEFT), queueHead(0), queueCount(0),
+                 hasUnpresentedAction(false), unpresentedTimestamp(0), latencySamples(0), latencyTotalMs(0), latencyMaxMs(0) {
+    for (int i = 0; i < 3; ++i) {
+        repeatKeys[i].held = false;
+        repeatKeys[i].nextRepeat = 0;
+    }
+}
+
+int dueGravityTicks(Uint32 until, Uint32 tickInterval, Uint32 &lastTick) {
+    if (static_cast<Sint32>(until - lastTick) >= static_cast<Sint32>(2 * tickInterval)) {
+        lastTick = until - tickInterval;
+    }
+    int ticks = 0;
+    while (static_cast<Sint32>(until - lastTick) >= static_cast<Sint32>(tickInterval)) {
+        lastTick += tickInterval;
+        ticks++;
+    }
+    return ticks;
+}
+
+void Input::setDelays(Uint32 dasMs, Uint32 arrMs) {
+    das = dasMs;
+    arr = arrMs > 0 ? arrMs : 1; // An ARR of 0 would repeat without bound
+}
+
+void Input::queueAction(InputAction action, Uint32 timestamp) {
+    if (queueCount == INPUT_QUEUE_SIZE) {
+        return; // Drop actions rather than grow; only happens after a long stall
+    }
+    queue[(queueHead + queueCount) % INPUT_QUEUE_SIZE] = {action, timestamp};
+    queueCount++;
+}
+
+// Of two held opposite directions only the one pressed last repeats
+int Input::activeHorizontalKey() const {
+    if (repeatKeys[lastHorizontalKey].held) {
+        return lastHorizontalKey;
+    }
+    int other = lastHorizontalKey == MOVE_LEFT ? MOVE_RIGHT : MOVE_LEFT;
+    if (repeatKeys[other].held) {
+        return other;
+    }
+    return -1;
+}
+
+// Index of the held key whose next repeat comes first, or -1 if nothing repeats
+int Input::nextRepeatKey() const {
+    int key = activeHorizontalKey();
+    if (repeatKeys[SOFT_DROP].held &&
+        (key < 0 || static_cast<Sint32>(repeatKeys[SOFT_DROP].nextRepeat - repeatKeys[key].nextRepeat) < 0)) {
+        key = SOFT_DROP;
+    }
+    return key;
+}
+
+void Input::queueRepeats(Uint32 until) {
+    int key = nextRepeatKey();
+    while (key >= 0 && static_cast<Sint32>(until - repeatKeys[key].nextRepeat) >= 0 && queueCount < INPUT_QUEUE_SIZE) {
+        queueAction(static_cast<InputAction>(key), repeatKeys[key].nextRepeat);
+        repeatKeys[key].nextRepeat += arr;
+        key = nextRepeatKey();
+    }
+}
+
+void Input::handleKeyEvent(const SDL_KeyboardEvent &key) {
+    // Repeats that fell due before this event happened first
+    queueRepeats(key.timestamp);
+
+    if (key.repeat) {
+        return; // OS key repeat is replaced by DAS/ARR
+    }
+
+    int repeatIndex = -1;
+    switch (key.keysym.sym) {
+        case SDLK_LEFT:
+            repeatIndex = MOVE_LEFT;
+            break;
+        case SDLK_RIGHT:
+            repeatIndex = MOVE_RIGHT;
+            break;
+        case SDLK_DOWN:
+            repeatIndex = SOFT_DROP;
+            break;
+        case SDLK_UP:
+            if (key.type == SDL_KEYDOWN) {
+                queueAction(ROTATE, key.timestamp);
+            }
+            return;
+        case SDLK_SPACE:
+            if (key.type == SDL_KEYDOWN) {
+                queueAction(HARD_DROP, key.timestamp);
+            }
+            return;
+        default:
+            return;
+    }
+
+    RepeatKey &repeatKey = repeatKeys[repeatIndex];
+    if (key.type == SDL_KEYDOWN) {
+        repeatKey.held = true;
+        repeatKey.nextRepeat = key.timestamp + das;
+        if (repeatIndex != SOFT_DROP) {
+            lastHorizontalKey = repeatIndex;
+        }
+        queueAction(static_cast<InputAction>(repeatIndex), key.timestamp);
+    } else {
+        repeatKey.held = false;
+        // A direction still held after its opposite is released charges DAS again from here
+        if (repeatIndex != SOFT_DROP) {
+            int other = repeatIndex == MOVE_LEFT ? MOVE_RIGHT : MOVE_LEFT;
+            if (repeatKeys[other].held && lastHorizontalKey == repeatIndex) {
+                lastHorizontalKey = other;
+                repeatKeys[other].nextRepeat = key.timestamp + das;
+            }
+        }
+    }
+}
+
+// Pops the next action in timestamp order, including repeats that are due by now
+bool Input::nextAction(Uint32 now, InputAction &action, Uint32 &timestamp) {
+    queueRepeats(now);
+    if (queueCount == 0) {
+        return false;
+    }
+
+    const QueuedAction &queued = queue[queueHead];
+    action = queued.action;
+    timestamp = queued.timestamp;
+    queueHead = (queueHead + 1) % INPUT_QUEUE_SIZE;
+    queueCount--;
+    return true;
+}
+
+Uint32 Input::msUntilNextRepeat(Uint32 now) const {
+    int key = nextRepeatKey();
+    if (key < 0) {
+        return UINT32_MAX;
+    }
+    Sint32 remaining = static_cast<Sint32>(repeatKeys[key].nextRepeat - now);
+    return remaining > 0 ? static_cast<Uint32>(remaining) : 0;
+}
+
+void Input::actionApplied(Uint32 timestamp) {
+    if (!hasUnpresentedAction) {
+        hasUnpresentedAction = true;
+        unpresentedTimestamp = timestamp;
+    }
+}
+
+void Input::framePresented(Uint32 presentTime) {
+    if (!hasUnpresentedAction) {
+        return;
+    }
+    Uint32 latency = presentTime - unpresentedTimestamp;
+    latencySamples++;
+    latencyTotalMs += latency;
+    if (latency > latencyMaxMs) {
+        latencyMaxMs = latency;
+    }
+    hasUnpresentedAction = false;
+}
+
+void Input::reportLatency() const {
+    if (latencySamples == 0) {
+        return;
+    }
+    std::cout << "Input-to-present latency: avg " << static_cast<double>(latencyTotalMs) / latencySamples
+              << " ms, max " << latencyMaxMs << " ms over " << latencySamples << " frames" << std::endl;
+}
@@ -1,7 +1,120 @@
 #include "game.h"
+#include "solver.h"
+#include <cstdlib>
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#elif defined(__linux__)
+#include <cstdio>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+// Seconds since the OS created this process, covering the loader, SDL's DLL and static
+// initialisation before main. Resolution is the OS tick (10-16 ms); -1 where unavailable.
+static double secondsSinceProcessStart() {
+#ifdef _WIN32
+    FILETIME creation, exitTime, kernel, user, now;
+    if (!GetProcessTimes(GetCurrentProcess(), &creation, &exitTime, &kernel, &user)) {
+        return -1;
+    }
+    GetSystemTimeAsFileTime(&now);
+    ULARGE_INTEGER start, current;
+    start.LowPart = creation.dwLowDateTime;
+    start.HighPart = creation.dwHighDateTime;
+    current.LowPart = now.dwLowDateTime;
+    current.HighPart = now.dwHighDateTime;
+    return (static_cast<double>(current.QuadPart) - static_cast<double>(start.QuadPart)) * 1e-7; // 100 ns units
+#elif defined(__linux__)
+    // Field 22 of /proc/self/stat is the start time in clock ticks since boot
+    FILE *file = fopen("/proc/self/stat", "r");
+    if (file == nullptr) {
+        return -1;
+    }
+    char buffer[1024];
+    size_t length = fread(buffer, 1, sizeof(buffer) - 1, file);
+    fclose(file);
+    buffer[length] = '\0';
+    const char *fields = strrchr(buffer, ')'); // The command name may contain spaces
+    unsigned long long startTicks = 0;
+    if (fields == nullptr || sscanf(fields + 2, "%*c %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %*s %llu", &startTicks) != 1) {
+        return -1;
+    }
+    struct timespec boot;
+    if (clock_gettime(CLOCK_BOOTTIME, &boot) != 0) {
+        return -1;
+    }
+    return boot.tv_sec + boot.tv_nsec * 1e-9 - static_cast<double>(startTicks) / sysconf(_SC_CLK_TCK);
+#else
+    return -1;
+#endif
+}
+
+// Performance counter value at process start, or at the top of main where the OS does not say
+static Uint64 processStartCounter() {
+    Uint64 now = SDL_GetPerformanceCounter();
+    double elapsed = secondsSinceProcessStart();
+    Uint64 elapsedTicks = static_cast<Uint64>(elapsed * SDL_GetPerformanceFrequency());
+    if (elapsed < 0 || elapsed > 60 || elapsedTicks > now) {
+        return now;
+    }
+    return now - elapsedTicks;
+}
 
 int main(int argc, char* argv[]) {
-    Game game;
+    Uint64 startupCounter = processStartCounter();
+
+    // --solve=<file> runs the puzzle solver without opening a window
+    for (int i = 1; i < argc; ++i) {
+        if (strncmp(argv[i], "--solve=", 8) == 0) {
+            return runSolver(argv[i] + 8);
+        }
+    }
+
+    // --startup-timing prints how long each startup phase took to reach since the process started
+    bool isStartupLogged = false;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--startup-timing") == 0) {
+            isStartupLogged = true;
+        }
+    }
+
+    Game game(startupCounter, isStartupLogged);
+
+    // Optional --das=<ms> and --arr=<ms> override the held-key repeat timings
+    Uint32 das = DEFAULT_DAS_MS;
+    Uint32 arr = DEFAULT_ARR_MS;
+    for (int i = 1; i < argc; ++i) {
+        if (strncmp(argv[i], "--das=", 6) == 0) {
+            das = static_cast<Uint32>(strtoul(argv[i] + 6, nullptr, 10));
+        } else if (strncmp(argv[i], "--arr=", 6) == 0) {
+            arr = static_cast<Uint32>(strtoul(argv[i] + 6, nullptr, 10));
+        }
+    }
+    game.setInputDelays(das, arr);
+
+    // Optional --weights=<file> makes the AI score positions with a neural network
+    for (int i = 1; i < argc; ++i) {
+        if (strncmp(argv[i], "--weights=", 10) == 0) {
+            game.loadEvaluatorWeights(argv[i] + 10);
+        }
+    }
+
+    // --raster-playfield uses the pixel-buffer playfield even on hardware renderers
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--raster-playfield") == 0) {
+            game.setRasterPlayfield(true);
+        }
+    }
+
+    // --alloc-check plays the AI briefly and fails if steady-state frames allocate
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--alloc-check") == 0) {
+            return game.runAllocationCheck(600);
+        }
+    }
+
     game.run();
     return 0;
 }
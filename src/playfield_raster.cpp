@@ -0,0 +1,107 @@
+#include "playfield_raster.h"
+#include "alloc_tracker.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+static const Uint32 EMPTY_COLOR = 0xFF000000;    // Matches the black SDL_RenderClear
+static const Uint32 BOUNDARY_COLOR = 0xFFFF0000; // Red top line and right boundary
+
+static Uint32 packColor(const Uint8 color[3]) {
+    return 0xFF000000 | (static_cast<Uint32>(color[0]) << 16) | (static_cast<Uint32>(color[1]) << 8) | color[2];
+}
+
+PlayfieldRaster::PlayfieldRaster() : texture(nullptr), needsFullRedraw(true) {
+}
+
+bool PlayfieldRaster::create(SDL_Renderer *renderer) {
+    texture = trackedCreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING,
+                                   PLAYFIELD_PIXEL_WIDTH, PLAYFIELD_PIXEL_HEIGHT);
+    if (texture == nullptr) {
+        std::cerr << "SDL_CreateTexture Error: " << SDL_GetError() << std::endl;
+        return false;
+    }
+    needsFullRedraw = true;
+    return true;
+}
+
+void PlayfieldRaster::destroy() {
+    if (texture != nullptr) {
+        trackedDestroyTexture(texture);
+        texture = nullptr;
+    }
+}
+
+bool PlayfieldRaster::isCreated() const {
+    return texture != nullptr;
+}
+
+// Fills one pixel line per cell row with horizontal spans of equal color, then copies it down
+// the rest of the row
+void PlayfieldRaster::rasterizeRows(Uint32 *pixels, int pitch, int firstRow, int lastRow) {
+    int pitchPixels = pitch / static_cast<int>(sizeof(Uint32));
+    for (int row = firstRow; row <= lastRow; ++row) {
+        Uint32 *line = pixels + (row - firstRow) * BLOCK_SIZE * pitchPixels;
+
+        int x = 0;
+        while (x < BOARD_WIDTH) {
+            int end = x + 1;
+            while (end < BOARD_WIDTH && cells[row][end] == cells[row][x]) {
+                end++;
+            }
+            std::fill(line + x * BLOCK_SIZE, line + end * BLOCK_SIZE, cells[row][x]);
+            x = end;
+        }
+        line[BOARD_WIDTH * BLOCK_SIZE] = BOUNDARY_COLOR;
+
+        for (int py = 1; py < BLOCK_SIZE; ++py) {
+            memcpy(line + py * pitchPixels, line, PLAYFIELD_PIXEL_WIDTH * sizeof(Uint32));
+        }
+        if (row == 0) {
+            std::fill(line, line + PLAYFIELD_PIXEL_WIDTH, BOUNDARY_COLOR);
+        }
+        memcpy(drawnCells[row], cells[row], sizeof(cells[row]));
+    }
+}
+
+void PlayfieldRaster::draw(SDL_Renderer *renderer, const Board &board) {
+    for (int y = 0; y < BOARD_HEIGHT; ++y) {
+        for (int x = 0; x < BOARD_WIDTH; ++x) {
+            const Cell &cell = board.getCell(x, y);
+            cells[y][x] = cell.filled ? packColor(cell.color) : EMPTY_COLOR;
+        }
+    }
+    const Piece &piece = board.getCurrentPiece();
+    for (int i = 0; i < 4; ++i) {
+        int x = piece.blocks[i].x + piece.position.x;
+        int y = piece.blocks[i].y + piece.position.y;
+        if (x >= 0 && x < BOARD_WIDTH && y >= 0 && y < BOARD_HEIGHT) {
+            cells[y][x] = packColor(piece.color);
+        }
+    }
+
+    // Locked pixels are write-only, so the locked band spans every row between the first and
+    // last dirty row and all of it is rewritten
+    int firstRow = BOARD_HEIGHT;
+    int lastRow = -1;
+    for (int y = 0; y < BOARD_HEIGHT; ++y) {
+        if (needsFullRedraw || memcmp(cells[y], drawnCells[y], sizeof(cells[y])) != 0) {
+            firstRow = std::min(firstRow, y);
+            lastRow = y;
+        }
+    }
+
+    if (lastRow >= 0) {
+        SDL_Rect band = {0, firstRow * BLOCK_SIZE, PLAYFIELD_PIXEL_WIDTH, (lastRow - firstRow + 1) * BLOCK_SIZE};
+        void *pixels;
+        int pitch;
+        if (SDL_LockTexture(texture, &band, &pixels, &pitch) == 0) {
+            rasterizeRows(static_cast<Uint32 *>(pixels), pitch, firstRow, lastRow);
+            SDL_UnlockTexture(texture);
+            needsFullRedraw = false;
+        }
+    }
+
+    SDL_Rect destination = {0, 0, PLAYFIELD_PIXEL_WIDTH, PLAYFIELD_PIXEL_HEIGHT};
+    SDL_RenderCopy(renderer, texture, NULL, &destination);
+}
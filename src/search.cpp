@@ -0,0 +1,174 @@
+#include "search.h"
+#include <algorithm>
+
+// Value of a lost position, below anything an evaluator is expected to return
+static const double GAME_OVER_VALUE = -1e9;
+
+static LinearEvaluator linearEvaluator;
+
+SearchContext::SearchContext() : evaluator(nullptr), maxDepth(AI_MAX_SEARCH_DEPTH), searchDeadline(0), searchTimedOut(false), lastSearchDepth(0) {
+}
+
+void SearchContext::setEvaluator(Evaluator *evaluator) {
+    this->evaluator = evaluator;
+}
+
+void SearchContext::setMaxDepth(int depth) {
+    maxDepth = depth;
+}
+
+void SearchContext::evaluateLeaves(int count) {
+    (evaluator != nullptr ? evaluator : &linearEvaluator)->evaluate(leafFeatures, count, leafValues);
+}
+
+bool SearchContext::isSearchOutOfTime() {
+    if (!searchTimedOut && SDL_GetPerformanceCounter() >= searchDeadline) {
+        searchTimedOut = true;
+    }
+    return searchTimedOut;
+}
+
+// Appends the features of every placement of the given shape to the leaf batch at offset.
+// Returns the number of placements added.
+int SearchContext::gatherPlacements(const BitBoard &board, const ShapeMask (*rotations)[BOARD_WIDTH], int linesCleared, int offset) {
+    int count = 0;
+    for (int rotation = 0; rotation < 4; ++rotation) {
+        for (int x = 0; x < BOARD_WIDTH; ++x) {
+            BitBoard child = board;
+            int cleared = placeMask(child, rotations[rotation][x]);
+            if (cleared < 0) {
+                continue;
+            }
+            extractFeatures(child, linesCleared + cleared, leafFeatures[offset + count]);
+            leafPlacements[offset + count] = rotation * BOARD_WIDTH + x;
+            count++;
+        }
+    }
+    return count;
+}
+
+// Chance node: the next piece is equally likely to be any of the 7 types. One level above the
+// leaves, all 7 types' placements are scored together in a single evaluator batch.
+double SearchContext::expectimax(const BitBoard &board, int depth, int linesCleared) {
+    double total = 0;
+
+    if (depth == 1) {
+        int counts[7];
+        int batch = 0;
+        for (int type = 0; type < 7; ++type) {
+            counts[type] = gatherPlacements(board, shapes[type], linesCleared, batch);
+            batch += counts[type];
+        }
+        evaluateLeaves(batch);
+
+        int offset = 0;
+        for (int type = 0; type < 7; ++type) {
+            double bestValue = GAME_OVER_VALUE;
+            for (int i = offset; i < offset + counts[type]; ++i) {
+                bestValue = std::max(bestValue, static_cast<double>(leafValues[i]));
+            }
+            total += bestValue;
+            offset += counts[type];
+        }
+        return total / 7;
+    }
+
+    for (int type = 0; type < 7; ++type) {
+        total += bestPlacementValue(board, shapes[type], depth - 1, linesCleared, -1, nullptr);
+        if (searchTimedOut) {
+            return 0;
+        }
+    }
+    return total / 7;
+}
+
+// Max node: the best placement of a piece with the given rotations, followed by depth chance
+// nodes. firstPlacement, if not -1, is searched before the others. bestPlacement, if given,
+// receives the winning rotation * BOARD_WIDTH + x; after a timeout it holds the best of the
+// placements that were searched completely, or -1 if there were none.
+double SearchContext::bestPlacementValue(const BitBoard &board, const ShapeMask (*rotations)[BOARD_WIDTH], int depth, int linesCleared, int firstPlacement, int *bestPlacement) {
+    double bestValue = GAME_OVER_VALUE;
+    int best = -1;
+
+    if (depth == 0) {
+        int count = gatherPlacements(board, rotations, linesCleared, 0);
+        evaluateLeaves(count);
+        for (int i = 0; i < count; ++i) {
+            if (best < 0 || leafValues[i] > bestValue) {
+                bestValue = leafValues[i];
+                best = leafPlacements[i];
+            }
+        }
+    } else {
+        for (int i = -1; i < 4 * BOARD_WIDTH; ++i) {
+            int placement = i < 0 ? firstPlacement : i;
+            if (placement < 0 || (i >= 0 && placement == firstPlacement)) {
+                continue;
+            }
+            if (isSearchOutOfTime()) {
+                break;
+            }
+            BitBoard child = board;
+            int cleared = placeMask(child, rotations[placement / BOARD_WIDTH][placement % BOARD_WIDTH]);
+            if (cleared < 0) {
+                continue;
+            }
+            double value = expectimax(child, depth, linesCleared + cleared);
+            if (searchTimedOut) {
+                break;
+            }
+            if (best < 0 || value > bestValue) {
+                bestValue = value;
+                best = placement;
+            }
+        }
+    }
+
+    if (bestPlacement != nullptr) {
+        *bestPlacement = best;
+    }
+    return bestValue;
+}
+
+// Iterative deepening expectimax. Depth 0 only scores the current piece's placements and always
+// completes; each further iteration looks one unknown piece deeper and searches the previous
+// iteration's best move first. An iteration cut off by the deadline still counts once that move
+// has been searched: the best move searched so far is then known to be at least as good.
+void SearchContext::search(const BitBoard &root, const Piece &currentPiece, double budgetMs, int &bestX, int &bestRotation) {
+    for (int type = 0; type < 7; ++type) {
+        Piece shapePiece = currentPiece;
+        shapePiece.setType(static_cast<TetrominoType>(type));
+        buildShapeMasks(shapePiece, shapes[type]);
+    }
+    // The current piece keeps its own block offsets, which may already be rotated
+    buildShapeMasks(currentPiece, currentShapes);
+
+    Uint64 budgetTicks = static_cast<Uint64>(budgetMs * SDL_GetPerformanceFrequency() / 1000.0);
+    searchDeadline = SDL_GetPerformanceCounter() + budgetTicks;
+    searchTimedOut = false;
+    lastSearchDepth = 0;
+
+    int previous = -1;
+    for (int depth = 0; depth <= maxDepth; ++depth) {
+        int best = -1;
+        bestPlacementValue(root, currentShapes, depth, 0, previous, &best);
+        bool isComplete = !(depth > 0 && searchTimedOut);
+        if (best >= 0 && (isComplete || previous >= 0)) {
+            bestX = best % BOARD_WIDTH;
+            bestRotation = best / BOARD_WIDTH;
+            previous = best;
+        }
+        if (!isComplete) {
+            break;
+        }
+        lastSearchDepth = depth;
+        // Do not start another iteration once the budget is spent
+        if (isSearchOutOfTime()) {
+            break;
+        }
+    }
+}
+
+int SearchContext::getLastSearchDepth() const {
+    return lastSearchDepth;
+}
@@ -0,0 +1,479 @@
+#include "solver.h"
+#include "bitboard.h"
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+
+// The solver works on the bitboards of bitboard.h. Placement uses the same move set as
+// Board::bestMove: rotate at spawn, shift to a column, hard drop.
+
+static const int MEMO_BITS = 20;
+static const int MAX_PUZZLE_PIECES = 64;
+
+static_assert(std::atomic<Uint64>::is_always_lock_free, "the memo relies on lock-free 64-bit atomics");
+
+// Full key of a search state: the 200 board bits at 10 per row, then piece index, lines cleared and
+// the memo generation in the last word. The failed budget sits in the spare top bits of that word.
+static const int MEMO_KEY_WORDS = 4;
+static const int ROWS_PER_KEY_WORD = 6;
+static const int KEY_PIECE_SHIFT = 2 * BOARD_WIDTH;
+static const int KEY_CLEARED_SHIFT = KEY_PIECE_SHIFT + 6;
+static const int KEY_GENERATION_SHIFT = KEY_CLEARED_SHIFT + 8;
+static const int KEY_REMAINING_SHIFT = 56;
+static const Uint64 MAX_MEMO_GENERATION = (1ULL << (KEY_REMAINING_SHIFT - KEY_GENERATION_SHIFT)) - 1;
+static const Uint64 KEY_REMAINING_MASK = 0xFFULL << KEY_REMAINING_SHIFT;
+
+typedef Uint64 MemoKey[MEMO_KEY_WORDS];
+
+// Seqlock-guarded entry: a writer makes version odd while it stores the words, and a reader that
+// sees an odd or changed version treats the entry as a miss
+struct PuzzleMemoEntry {
+    std::atomic<Uint64> version;
+    std::atomic<Uint64> words[MEMO_KEY_WORDS];
+};
+
+static Uint64 mix(Uint64 x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+static void makeKey(const BitBoard &board, int pieceIndex, int cleared, Uint64 generation, MemoKey key) {
+    for (int word = 0; word < MEMO_KEY_WORDS; ++word) {
+        key[word] = 0;
+    }
+    for (int y = 0; y < BOARD_HEIGHT; ++y) {
+        key[y / ROWS_PER_KEY_WORD] |= static_cast<Uint64>(board.rows[y]) << (y % ROWS_PER_KEY_WORD * BOARD_WIDTH);
+    }
+    key[MEMO_KEY_WORDS - 1] |= static_cast<Uint64>(pieceIndex) << KEY_PIECE_SHIFT |
+                               static_cast<Uint64>(cleared) << KEY_CLEARED_SHIFT | generation << KEY_GENERATION_SHIFT;
+}
+
+static Uint64 hashKey(const MemoKey key) {
+    Uint64 hash = 0;
+    for (int word = 0; word < MEMO_KEY_WORDS; ++word) {
+        hash = mix(hash ^ key[word]);
+    }
+    return hash;
+}
+
+// Budget the state failed with, or -1 if the entry holds another state or is being written
+static int lookupFailedBudget(const PuzzleMemoEntry &entry, const MemoKey key) {
+    Uint64 version = entry.version.load(std::memory_order_acquire);
+    if (version & 1) {
+        return -1;
+    }
+    Uint64 words[MEMO_KEY_WORDS];
+    for (int word = 0; word < MEMO_KEY_WORDS; ++word) {
+        words[word] = entry.words[word].load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (entry.version.load(std::memory_order_relaxed) != version) {
+        return -1;
+    }
+    for (int word = 0; word < MEMO_KEY_WORDS - 1; ++word) {
+        if (words[word] != key[word]) {
+            return -1;
+        }
+    }
+    Uint64 last = words[MEMO_KEY_WORDS - 1];
+    if ((last & ~KEY_REMAINING_MASK) != key[MEMO_KEY_WORDS - 1]) {
+        return -1;
+    }
+    return static_cast<int>(last >> KEY_REMAINING_SHIFT);
+}
+
+// Skips the store if another thread is writing the entry; the memo is only a cache
+static void storeFailedBudget(PuzzleMemoEntry &entry, const MemoKey key, int remaining) {
+    Uint64 version = entry.version.load(std::memory_order_relaxed);
+    if ((version & 1) || !entry.version.compare_exchange_strong(version, version + 1, std::memory_order_acquire)) {
+        return;
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+    for (int word = 0; word < MEMO_KEY_WORDS - 1; ++word) {
+        entry.words[word].store(key[word], std::memory_order_relaxed);
+    }
+    entry.words[MEMO_KEY_WORDS - 1].store(key[MEMO_KEY_WORDS - 1] | static_cast<Uint64>(remaining) << KEY_REMAINING_SHIFT, std::memory_order_relaxed);
+    entry.version.store(version + 2, std::memory_order_release);
+}
+
+PuzzleMemo::PuzzleMemo() : entries(nullptr), generation(0) {
+}
+
+PuzzleMemo::~PuzzleMemo() {
+    free(entries);
+}
+
+class PuzzleSearch {
+public:
+    PuzzleSearch(const Puzzle &puzzle, PuzzleMemoEntry *memo, Uint64 generation);
+    bool search(const BitBoard &root, int depth, int threadCount, std::vector<SolutionStep> &steps);
+    Uint64 getNodes() const;
+
+private:
+    struct Worker {
+        SolutionStep path[MAX_PUZZLE_PIECES];
+        int length;  // Pieces in path when the goal was reached
+        Uint64 nodes;
+        int task;
+    };
+
+    bool isGoal(const BitBoard &board, int pieceIndex, int cleared) const;
+    bool canReachGoal(const BitBoard &board, int cleared, int remaining) const;
+    bool dfs(Worker &worker, const BitBoard &board, int pieceIndex, int remaining, int cleared);
+    void runWorker(int depth);
+
+    const Puzzle &puzzle;
+    ShapeMask shapes[7][4][BOARD_WIDTH];
+    PuzzleMemoEntry *memo;  // 1 << MEMO_BITS entries
+    Uint64 generation;      // Part of every key, so entries of earlier solves never match
+
+    // Root split of the current iteration: one task per placement of the first piece
+    BitBoard rootChildren[4 * BOARD_WIDTH];
+    int rootCleared[4 * BOARD_WIDTH];
+    SolutionStep rootSteps[4 * BOARD_WIDTH];
+    int taskCount;
+    std::atomic<int> nextTask;
+    std::atomic<int> foundTask;
+    std::vector<SolutionStep> solutions[4 * BOARD_WIDTH];
+    std::mutex resultMutex;
+    std::atomic<Uint64> totalNodes;
+};
+
+PuzzleSearch::PuzzleSearch(const Puzzle &puzzle, PuzzleMemoEntry *memo, Uint64 generation) : puzzle(puzzle), memo(memo), generation(generation), taskCount(0), nextTask(0), foundTask(INT_MAX), totalNodes(0) {
+    for (int type = 0; type < 7; ++type) {
+        Piece piece = puzzle.board.getCurrentPiece();
+        piece.setType(static_cast<TetrominoType>(type));
+        buildShapeMasks(piece, shapes[type]);
+    }
+}
+
+Uint64 PuzzleSearch::getNodes() const {
+    return totalNodes.load();
+}
+
+bool PuzzleSearch::isGoal(const BitBoard &board, int pieceIndex, int cleared) const {
+    if (puzzle.goal == CLEAR_LINES) {
+        return cleared >= puzzle.targetLines;
+    }
+    if (pieceIndex == 0) {
+        return false; // The starting position does not count as a perfect clear
+    }
+    for (int y = 0; y < BOARD_HEIGHT; ++y) {
+        if (board.rows[y] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Cell-count bounds: every cleared row needs all of its empty cells filled by new pieces, 4 cells each
+bool PuzzleSearch::canReachGoal(const BitBoard &board, int cleared, int remaining) const {
+    int filled = 0;
+    int nonEmptyRows = 0;
+    int rowsWithEmpties[BOARD_WIDTH + 1] = {0};
+    for (int y = 0; y < BOARD_HEIGHT; ++y) {
+        int count = popCount(board.rows[y]);
+        filled += count;
+        rowsWithEmpties[BOARD_WIDTH - count]++;
+        if (count > 0) {
+            nonEmptyRows++;
+        }
+    }
+
+    if (puzzle.goal == PERFECT_CLEAR) {
+        // After k pieces every non-empty row and possibly new ones are cleared: filled + 4k = 10 * lines.
+        // Empty rows below the stack never need filling.
+        for (int k = 1; k <= remaining; ++k) {
+            if ((filled + 4 * k) % BOARD_WIDTH == 0 && filled + 4 * k >= nonEmptyRows * BOARD_WIDTH) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Cheapest rows to complete first
+    int needed = puzzle.targetLines - cleared;
+    int cells = 0;
+    for (int empties = 0; empties <= BOARD_WIDTH && needed > 0; ++empties) {
+        int take = std::min(needed, rowsWithEmpties[empties]);
+        cells += take * empties;
+        needed -= take;
+    }
+    return needed == 0 && cells <= 4 * remaining;
+}
+
+bool PuzzleSearch::dfs(Worker &worker, const BitBoard &board, int pieceIndex, int remaining, int cleared) {
+    if (isGoal(board, pieceIndex, cleared)) {
+        worker.length = pieceIndex;
+        return true;
+    }
+    if (remaining == 0 || !canReachGoal(board, cleared, remaining)) {
+        return false;
+    }
+
+    // A state that already failed with at least this many pieces left cannot succeed now
+    MemoKey key;
+    makeKey(board, pieceIndex, cleared, generation, key);
+    PuzzleMemoEntry &entry = memo[hashKey(key) & ((static_cast<Uint64>(1) << MEMO_BITS) - 1)];
+    if (lookupFailedBudget(entry, key) >= remaining) {
+        return false;
+    }
+
+    TetrominoType type = puzzle.pieces[pieceIndex];
+    for (int rotation = 0; rotation < 4; ++rotation) {
+        for (int x = 0; x < BOARD_WIDTH; ++x) {
+            // Give up once a task earlier in the root order has found a solution
+            if (foundTask.load(std::memory_order_relaxed) < worker.task) {
+                return false;
+            }
+            BitBoard child = board;
+            int lines = placeMask(child, shapes[type][rotation][x]);
+            if (lines < 0) {
+                continue;
+            }
+            worker.nodes++;
+            worker.path[pieceIndex] = {type, rotation, x};
+            if (dfs(worker, child, pieceIndex + 1, remaining - 1, cleared + lines)) {
+                return true;
+            }
+        }
+    }
+
+    if (foundTask.load(std::memory_order_relaxed) >= worker.task) {
+        storeFailedBudget(entry, key, remaining);
+    }
+    return false;
+}
+
+void PuzzleSearch::runWorker(int depth) {
+    Worker worker;
+    worker.length = 0;
+    worker.nodes = 0;
+
+    for (;;) {
+        int task = nextTask.fetch_add(1);
+        if (task >= taskCount || task > foundTask.load()) {
+            break;
+        }
+        worker.task = task;
+        worker.path[0] = rootSteps[task];
+        if (dfs(worker, rootChildren[task], 1, depth - 1, rootCleared[task])) {
+            std::lock_guard<std::mutex> lock(resultMutex);
+            solutions[task].assign(worker.path, worker.path + worker.length);
+            int current = foundTask.load();
+            while (task < current && !foundTask.compare_exchange_weak(current, task)) {
+            }
+        }
+    }
+    totalNodes += worker.nodes;
+}
+
+// One iterative deepening step: is there a solution using at most depth pieces? Root placements
+// are handed out to threads in order, and the solution under the earliest root placement wins.
+bool PuzzleSearch::search(const BitBoard &root, int depth, int threadCount, std::vector<SolutionStep> &steps) {
+    TetrominoType type = puzzle.pieces[0];
+    taskCount = 0;
+    for (int rotation = 0; rotation < 4; ++rotation) {
+        for (int x = 0; x < BOARD_WIDTH; ++x) {
+            BitBoard child = root;
+            int lines = placeMask(child, shapes[type][rotation][x]);
+            if (lines < 0) {
+                continue;
+            }
+            // placeMask only looks at the rows it filled; a loaded position may hold other full rows
+            lines += clearFullRows(child);
+            rootChildren[taskCount] = child;
+            rootCleared[taskCount] = lines;
+            rootSteps[taskCount] = {type, rotation, x};
+            taskCount++;
+        }
+    }
+    totalNodes += taskCount;
+    nextTask = 0;
+    foundTask = INT_MAX;
+
+    std::vector<std::thread> threads;
+    for (int i = 1; i < threadCount; ++i) {
+        threads.emplace_back(&PuzzleSearch::runWorker, this, depth);
+    }
+    runWorker(depth);
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+
+    if (foundTask.load() == INT_MAX) {
+        return false;
+    }
+    steps = solutions[foundTask.load()];
+    return true;
+}
+
+SolveResult solvePuzzle(const Puzzle &puzzle, int threadCount, PuzzleMemo &memo) {
+    SolveResult result;
+    result.solved = false;
+    result.nodes = 0;
+    result.seconds = 0;
+
+    BitBoard root;
+    for (int y = 0; y < BOARD_HEIGHT; ++y) {
+        root.rows[y] = 0;
+        for (int x = 0; x < BOARD_WIDTH; ++x) {
+            if (puzzle.board.isCellFilled(x, y)) {
+                root.rows[y] |= static_cast<Row>(1 << x);
+            }
+        }
+    }
+
+    Uint64 start = SDL_GetPerformanceCounter();
+    if (puzzle.goal == CLEAR_LINES && puzzle.targetLines <= 0) {
+        result.solved = true;
+    } else if (!puzzle.pieces.empty()) {
+        // calloc leaves the pages untouched until the search reaches them, so a short solve stays cheap
+        size_t entryCount = static_cast<size_t>(1) << MEMO_BITS;
+        if (memo.entries == nullptr) {
+            memo.entries = static_cast<PuzzleMemoEntry *>(calloc(entryCount, sizeof(PuzzleMemoEntry)));
+            if (memo.entries == nullptr) {
+                std::cerr << "Cannot allocate the solver memo" << std::endl;
+                return result;
+            }
+        }
+        if (memo.generation == MAX_MEMO_GENERATION) {
+            memset(static_cast<void *>(memo.entries), 0, entryCount * sizeof(PuzzleMemoEntry));
+            memo.generation = 0;
+        }
+        memo.generation++;
+
+        PuzzleSearch search(puzzle, memo.entries, memo.generation);
+        int maxDepth = std::min(static_cast<int>(puzzle.pieces.size()), MAX_PUZZLE_PIECES);
+        for (int depth = 1; depth <= maxDepth && !result.solved; ++depth) {
+            result.solved = search.search(root, depth, std::max(threadCount, 1), result.steps);
+        }
+        result.nodes = search.getNodes();
+    }
+    result.seconds = static_cast<double>(SDL_GetPerformanceCounter() - start) / SDL_GetPerformanceFrequency();
+    return result;
+}
+
+static bool parsePieceType(const std::string &name, TetrominoType &type) {
+    static const char *names[7] = {"I", "O", "T", "S", "Z", "J", "L"};
+    for (int i = 0; i < 7; ++i) {
+        if (name == names[i]) {
+            type = static_cast<TetrominoType>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Text format, '#' starts a comment line:
+//   goal lines <n> | goal perfect
+//   pieces <I|O|T|S|Z|J|L>...
+//   then up to 20 rows of 10 characters, '.' empty and 'X' filled, aligned to the bottom of the board
+bool loadPuzzle(const char *path, Puzzle &puzzle) {
+    std::ifstream file(path);
+    if (!file) {
+        std::cerr << "Cannot open puzzle " << path << std::endl;
+        return false;
+    }
+
+    puzzle.goal = CLEAR_LINES;
+    puzzle.targetLines = 1;
+    puzzle.pieces.clear();
+    std::vector<std::string> rows;
+
+    std::string line;
+    while (std::getline(file, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::istringstream stream(line);
+        std::string keyword;
+        stream >> keyword;
+        if (keyword == "goal") {
+            std::string kind;
+            stream >> kind;
+            if (kind == "perfect") {
+                puzzle.goal = PERFECT_CLEAR;
+            } else if (kind == "lines" && stream >> puzzle.targetLines) {
+                puzzle.goal = CLEAR_LINES;
+            } else {
+                std::cerr << path << ": unknown goal '" << line << "'" << std::endl;
+                return false;
+            }
+        } else if (keyword == "pieces") {
+            std::string name;
+            while (stream >> name) {
+                TetrominoType type;
+                if (!parsePieceType(name, type)) {
+                    std::cerr << path << ": unknown piece '" << name << "'" << std::endl;
+                    return false;
+                }
+                puzzle.pieces.push_back(type);
+            }
+        } else if (static_cast<int>(line.size()) == BOARD_WIDTH && line.find_first_not_of(".X") == std::string::npos) {
+            rows.push_back(line);
+        } else {
+            std::cerr << path << ": cannot parse '" << line << "'" << std::endl;
+            return false;
+        }
+    }
+
+    if (static_cast<int>(rows.size()) > BOARD_HEIGHT) {
+        std::cerr << path << ": more than " << BOARD_HEIGHT << " rows" << std::endl;
+        return false;
+    }
+    if (static_cast<int>(puzzle.pieces.size()) > MAX_PUZZLE_PIECES) {
+        std::cerr << path << ": more than " << MAX_PUZZLE_PIECES << " pieces" << std::endl;
+        return false;
+    }
+
+    int top = BOARD_HEIGHT - static_cast<int>(rows.size());
+    for (int y = 0; y < BOARD_HEIGHT; ++y) {
+        for (int x = 0; x < BOARD_WIDTH; ++x) {
+            puzzle.board.setCellFilled(x, y, y >= top && rows[y - top][x] == 'X');
+        }
+    }
+    return true;
+}
+
+// Entry point for Tetris --solve=<file>. Returns the process exit code.
+int runSolver(const char *path) {
+    Puzzle puzzle;
+    if (!loadPuzzle(path, puzzle)) {
+        return 2;
+    }
+
+    int threadCount = static_cast<int>(std::thread::hardware_concurrency());
+    PuzzleMemo memo;
+    SolveResult result = solvePuzzle(puzzle, threadCount, memo);
+
+    static const char *names[7] = {"I", "O", "T", "S", "Z", "J", "L"};
+    if (result.solved) {
+        std::cout << "Solved with " << result.steps.size() << " pieces:" << std::endl;
+        for (size_t i = 0; i < result.steps.size(); ++i) {
+            const SolutionStep &step = result.steps[i];
+            std::cout << "  " << (i + 1) << ". " << names[step.type] << " rotation " << step.rotation << " x " << step.x << std::endl;
+        }
+    } else {
+        std::cout << "No solution with the given pieces" << std::endl;
+    }
+    double nodesPerSecond = result.seconds > 0 ? result.nodes / result.seconds : 0;
+    std::cout << result.nodes << " nodes in " << result.seconds << " s (" << nodesPerSecond << " nodes/s, "
+              << std::max(threadCount, 1) << " threads)" << std::endl;
+    return result.solved ? 0 : 1;
+}
@@ -0,0 +1,280 @@
+#include "tetris_env.h"
+#include "board.h"
+#include <cstdlib>
+#include <cstring>
+#include <climits>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+static_assert(TETRIS_ENV_BOARD_WIDTH == BOARD_WIDTH && TETRIS_ENV_BOARD_HEIGHT == BOARD_HEIGHT,
+              "tetris_env.h must match the board size");
+
+struct TetrisEnv {
+    std::vector<Board> boards;
+    std::mt19937 random; // Seeds for new boards
+    TetrisEnvHeader *header;
+    TetrisEnvBuffers buffers;
+    bool isShared;
+    std::string sharedName;
+#ifdef _WIN32
+    HANDLE mapping;
+#endif
+};
+
+static uint32_t alignOffset(uint32_t offset) {
+    return (offset + 63) & ~63u;
+}
+
+static void computeLayout(TetrisEnvHeader &layout, int32_t count) {
+    layout.magic = TETRIS_ENV_MAGIC;
+    layout.version = TETRIS_ENV_VERSION;
+    layout.count = count;
+    layout.observationSize = TETRIS_ENV_OBS_SIZE;
+    layout.actionsOffset = alignOffset(sizeof(TetrisEnvHeader));
+    layout.observationsOffset = alignOffset(layout.actionsOffset + count * sizeof(int32_t));
+    layout.rewardsOffset = alignOffset(layout.observationsOffset + count * TETRIS_ENV_OBS_SIZE);
+    layout.donesOffset = alignOffset(layout.rewardsOffset + count * sizeof(float));
+    layout.totalSize = alignOffset(layout.donesOffset + count);
+    layout.command = TETRIS_ENV_STEP;
+    layout.request = 0;
+    layout.response = 0;
+}
+
+static void writeObservation(const Board &board, uint8_t *observation) {
+    for (int y = 0; y < BOARD_HEIGHT; ++y) {
+        for (int x = 0; x < BOARD_WIDTH; ++x) {
+            observation[y * BOARD_WIDTH + x] = board.isCellFilled(x, y) ? 1 : 0;
+        }
+    }
+    observation[BOARD_WIDTH * BOARD_HEIGHT] = static_cast<uint8_t>(board.getCurrentPiece().type);
+}
+
+// Wires the buffers to a block that already holds a filled-in header, then creates the boards
+static TetrisEnv *initialize(TetrisEnv *env, void *block, const TetrisEnvHeader &layout, uint32_t seed) {
+    env->header = static_cast<TetrisEnvHeader *>(block);
+    memset(block, 0, layout.totalSize);
+    *env->header = layout;
+
+    char *base = static_cast<char *>(block);
+    env->buffers.actions = reinterpret_cast<int32_t *>(base + layout.actionsOffset);
+    env->buffers.observations = reinterpret_cast<uint8_t *>(base + layout.observationsOffset);
+    env->buffers.rewards = reinterpret_cast<float *>(base + layout.rewardsOffset);
+    env->buffers.dones = reinterpret_cast<uint8_t *>(base + layout.donesOffset);
+
+    env->random.seed(seed);
+    env->boards.resize(layout.count);
+    tetris_env_reset(env);
+    return env;
+}
+
+// Spins this many polls before blocking; a step of a few boards finishes well within it
+static const int SPIN_COUNT = 4000;
+
+// Waits until the shared word differs from old and returns the new value, with acquire ordering
+// so everything written before it was stored is visible
+static uint32_t waitForChange(uint32_t *word, uint32_t old) {
+    for (int spin = 0; spin < SPIN_COUNT; ++spin) {
+        uint32_t value = __atomic_load_n(word, __ATOMIC_ACQUIRE);
+        if (value != old) {
+            return value;
+        }
+    }
+    for (int attempt = 0;; ++attempt) {
+        uint32_t value = __atomic_load_n(word, __ATOMIC_ACQUIRE);
+        if (value != old) {
+            return value;
+        }
+#if defined(__linux__)
+        // Returns at once if the word has already changed, so a wake cannot be missed
+        syscall(SYS_futex, word, FUTEX_WAIT, old, nullptr, nullptr, 0);
+        (void)attempt;
+#elif defined(_WIN32)
+        Sleep(attempt < 16 ? 0 : 1);
+#else
+        usleep(attempt < 16 ? 0 : 500);
+#endif
+    }
+}
+
+static void wakeWaiters(uint32_t *word) {
+#if defined(__linux__)
+    syscall(SYS_futex, word, FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#else
+    (void)word;
+#endif
+}
+
+extern "C" {
+
+TetrisEnv *tetris_env_create(int32_t count, uint32_t seed) {
+    if (count <= 0) {
+        return nullptr;
+    }
+    TetrisEnvHeader layout;
+    computeLayout(layout, count);
+
+    void *block = malloc(layout.totalSize);
+    if (block == nullptr) {
+        return nullptr;
+    }
+    TetrisEnv *env = new (std::nothrow) TetrisEnv();
+    if (env == nullptr) {
+        free(block);
+        return nullptr;
+    }
+    env->isShared = false;
+    return initialize(env, block, layout, seed);
+}
+
+TetrisEnv *tetris_env_create_shared(const char *name, int32_t count, uint32_t seed) {
+    if (count <= 0 || name == nullptr) {
+        return nullptr;
+    }
+    TetrisEnvHeader layout;
+    computeLayout(layout, count);
+
+    TetrisEnv *env = new (std::nothrow) TetrisEnv();
+    if (env == nullptr) {
+        return nullptr;
+    }
+    env->isShared = true;
+
+#ifdef _WIN32
+    env->sharedName = name;
+    env->mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, 0, layout.totalSize, name);
+    if (env->mapping == NULL) {
+        delete env;
+        return nullptr;
+    }
+    void *block = MapViewOfFile(env->mapping, FILE_MAP_ALL_ACCESS, 0, 0, layout.totalSize);
+    if (block == NULL) {
+        CloseHandle(env->mapping);
+        delete env;
+        return nullptr;
+    }
+#else
+    // POSIX shared-memory names start with a single slash
+    env->sharedName = name[0] == '/' ? name : std::string("/") + name;
+    int fd = shm_open(env->sharedName.c_str(), O_CREAT | O_RDWR, 0600);
+    if (fd < 0) {
+        delete env;
+        return nullptr;
+    }
+    if (ftruncate(fd, layout.totalSize) != 0) {
+        close(fd);
+        shm_unlink(env->sharedName.c_str());
+        delete env;
+        return nullptr;
+    }
+    void *block = mmap(nullptr, layout.totalSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (block == MAP_FAILED) {
+        shm_unlink(env->sharedName.c_str());
+        delete env;
+        return nullptr;
+    }
+#endif
+    return initialize(env, block, layout, seed);
+}
+
+void tetris_env_destroy(TetrisEnv *env) {
+    if (env == nullptr) {
+        return;
+    }
+    if (!env->isShared) {
+        free(env->header);
+    } else {
+#ifdef _WIN32
+        UnmapViewOfFile(env->header);
+        CloseHandle(env->mapping);
+#else
+        munmap(env->header, env->header->totalSize);
+        shm_unlink(env->sharedName.c_str());
+#endif
+    }
+    delete env;
+}
+
+TetrisEnvBuffers tetris_env_buffers(TetrisEnv *env) {
+    return env->buffers;
+}
+
+void tetris_env_reset(TetrisEnv *env) {
+    for (int32_t i = 0; i < env->header->count; ++i) {
+        env->boards[i] = Board(env->random());
+        writeObservation(env->boards[i], env->buffers.observations + i * TETRIS_ENV_OBS_SIZE);
+        env->buffers.rewards[i] = 0;
+        env->buffers.dones[i] = 0;
+    }
+}
+
+void tetris_env_step(TetrisEnv *env, const int32_t *actions) {
+    for (int32_t i = 0; i < env->header->count; ++i) {
+        Board &board = env->boards[i];
+        int32_t action = actions[i];
+        if (action < 0 || action >= TETRIS_ENV_ACTION_COUNT) {
+            action = 0;
+        }
+        int scoreBefore = board.getScore();
+        board.placePiece(action % BOARD_WIDTH, action / BOARD_WIDTH);
+
+        env->buffers.rewards[i] = static_cast<float>(board.getScore() - scoreBefore);
+        env->buffers.dones[i] = board.isGameOver() ? 1 : 0;
+        if (board.isGameOver()) {
+            board = Board(env->random());
+        }
+        writeObservation(board, env->buffers.observations + i * TETRIS_ENV_OBS_SIZE);
+    }
+}
+
+int tetris_env_serve(TetrisEnv *env) {
+    if (!env->isShared) {
+        return -1;
+    }
+    TetrisEnvHeader *header = env->header;
+    uint32_t served = __atomic_load_n(&header->response, __ATOMIC_RELAXED);
+    for (;;) {
+        uint32_t request = waitForChange(&header->request, served);
+        int32_t command = header->command;
+        if (command == TETRIS_ENV_RESET) {
+            tetris_env_reset(env);
+        } else if (command == TETRIS_ENV_STEP) {
+            tetris_env_step(env, env->buffers.actions);
+        }
+
+        served = request;
+        __atomic_store_n(&header->response, served, __ATOMIC_RELEASE);
+        wakeWaiters(&header->response);
+        if (command == TETRIS_ENV_SHUTDOWN) {
+            return 0;
+        }
+    }
+}
+
+void tetris_env_post(TetrisEnvHeader *header, int32_t command) {
+    header->command = command;
+    uint32_t request = __atomic_load_n(&header->request, __ATOMIC_RELAXED) + 1;
+    __atomic_store_n(&header->request, request, __ATOMIC_RELEASE);
+    wakeWaiters(&header->request);
+
+    uint32_t response = __atomic_load_n(&header->response, __ATOMIC_ACQUIRE);
+    while (response != request) {
+        response = waitForChange(&header->response, response);
+    }
+}
+
+}
@@ -0,0 +1,101 @@
+// Built with TRACK_ALLOCATIONS: checks that every form of operator new is counted, then plays AI
+// moves headless with the linear and the neural evaluator and fails on any steady-state
+// allocation: alloc_test <weights/linear_mlp.txt>
+#include "alloc_tracker.h"
+#include "board.h"
+#include "search.h"
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+static int failures = 0;
+
+static void check(bool condition, const char *what) {
+    if (!condition) {
+        std::cerr << "FAILED: " << what << std::endl;
+        failures++;
+    }
+}
+
+// Stores through a volatile pointer so the compiler cannot elide the allocations
+static void *volatile sink;
+
+struct alignas(64) CacheLine {
+    char bytes[64];
+};
+
+static void testOperatorsAreCounted() {
+    AllocationCounts before = allocationCounts();
+    sink = new int(1);
+    delete static_cast<int *>(sink);
+    check(allocationsSince(before) == 1, "operator new is counted");
+
+    before = allocationCounts();
+    sink = new int[4];
+    delete[] static_cast<int *>(sink);
+    check(allocationsSince(before) == 1, "operator new[] is counted");
+
+    before = allocationCounts();
+    sink = new (std::nothrow) int(1);
+    delete static_cast<int *>(sink);
+    check(allocationsSince(before) == 1, "nothrow operator new is counted");
+
+    before = allocationCounts();
+    sink = new CacheLine;
+    check(reinterpret_cast<uintptr_t>(sink) % 64 == 0, "aligned operator new honours the alignment");
+    delete static_cast<CacheLine *>(sink);
+    check(allocationsSince(before) == 1, "aligned operator new is counted");
+
+    before = allocationCounts();
+    sink = new CacheLine[3];
+    delete[] static_cast<CacheLine *>(sink);
+    check(allocationsSince(before) == 1, "aligned operator new[] is counted");
+}
+
+// Allocations made by AI moves after a warm-up
+static Uint64 playMoves(Evaluator *evaluator) {
+    static SearchContext context;
+    context.setEvaluator(evaluator);
+    Board board;
+    Uint64 total = 0;
+    for (int move = 0; move < 320; ++move) {
+        AllocationCounts before = allocationCounts();
+        if (board.isGameOver()) {
+            board = Board();
+        }
+        int bestX = 0;
+        int bestRotation = 0;
+        board.bestMove(bestX, bestRotation, context);
+        board.placePiece(bestX, bestRotation);
+        if (move >= 20) {
+            total += allocationsSince(before);
+        }
+    }
+    return total;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: alloc_test <weights file>" << std::endl;
+        return 2;
+    }
+    if (SDL_Init(SDL_INIT_TIMER) != 0) {
+        std::cerr << "SDL_Init Error: " << SDL_GetError() << std::endl;
+        return 2;
+    }
+    srand(3);
+
+    testOperatorsAreCounted();
+
+    check(playMoves(nullptr) == 0, "AI moves with the linear evaluator do not allocate");
+    NeuralEvaluator neural;
+    check(neural.load(argv[1]), "weights load");
+    check(playMoves(&neural) == 0, "AI moves with the neural evaluator do not allocate");
+
+    SDL_Quit();
+    if (failures == 0) {
+        std::cout << "alloc_test: all checks passed" << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,142 @@
+// Drives Input with synthetic SDL key events and checks the actions and timestamps it produces,
+// and the gravity catch-up rule
+#include "input.h"
+#include <iostream>
+#include <vector>
+
+static int failures = 0;
+
+static void check(bool condition, const char *what) {
+    if (!condition) {
+        std::cerr << "FAILED: " << what << std::endl;
+        failures++;
+    }
+}
+
+static void keyEvent(Input &input, Uint32 type, SDL_Keycode sym, Uint32 timestamp, bool isRepeat = false) {
+    SDL_KeyboardEvent key = {};
+    key.type = type;
+    key.timestamp = timestamp;
+    key.repeat = isRepeat ? 1 : 0;
+    key.keysym.sym = sym;
+    input.handleKeyEvent(key);
+}
+
+struct Action {
+    InputAction action;
+    Uint32 timestamp;
+};
+
+static std::vector<Action> drain(Input &input, Uint32 now) {
+    std::vector<Action> actions;
+    InputAction action;
+    Uint32 timestamp;
+    while (input.nextAction(now, action, timestamp)) {
+        actions.push_back({action, timestamp});
+    }
+    return actions;
+}
+
+static bool isSame(const std::vector<Action> &actions, const std::vector<Action> &expected) {
+    if (actions.size() != expected.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < actions.size(); ++i) {
+        if (actions[i].action != expected[i].action || actions[i].timestamp != expected[i].timestamp) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void testDasThenArr() {
+    Input input;
+    input.setDelays(100, 20);
+    keyEvent(input, SDL_KEYDOWN, SDLK_LEFT, 1000);
+    check(isSame(drain(input, 1000), {{MOVE_LEFT, 1000}}), "press moves at once");
+    check(input.msUntilNextRepeat(1000) == 100, "first repeat scheduled DAS after the press");
+    check(drain(input, 1099).empty(), "no repeat before DAS");
+    check(isSame(drain(input, 1100), {{MOVE_LEFT, 1100}}), "first repeat exactly DAS after the press");
+    check(isSame(drain(input, 1165), {{MOVE_LEFT, 1120}, {MOVE_LEFT, 1140}, {MOVE_LEFT, 1160}}), "then one repeat every ARR");
+    check(input.msUntilNextRepeat(1165) == 15, "next repeat on the ARR grid");
+    keyEvent(input, SDL_KEYUP, SDLK_LEFT, 1170);
+    check(drain(input, 2000).empty(), "release stops repeats");
+    check(input.msUntilNextRepeat(2000) == UINT32_MAX, "nothing left to repeat");
+}
+
+static void testOsRepeatIgnored() {
+    Input input;
+    input.setDelays(100, 20);
+    keyEvent(input, SDL_KEYDOWN, SDLK_RIGHT, 0);
+    keyEvent(input, SDL_KEYDOWN, SDLK_RIGHT, 30, true);
+    keyEvent(input, SDL_KEYDOWN, SDLK_RIGHT, 60, true);
+    keyEvent(input, SDL_KEYDOWN, SDLK_UP, 70);
+    keyEvent(input, SDL_KEYDOWN, SDLK_UP, 80, true);
+    check(isSame(drain(input, 99), {{MOVE_RIGHT, 0}, {ROTATE, 70}}), "OS key repeat produces no actions");
+    check(isSame(drain(input, 100), {{MOVE_RIGHT, 100}}), "OS key repeat does not restart DAS");
+}
+
+static void testLastDirectionWins() {
+    Input input;
+    input.setDelays(100, 20);
+    keyEvent(input, SDL_KEYDOWN, SDLK_LEFT, 0);
+    keyEvent(input, SDL_KEYDOWN, SDLK_RIGHT, 50);
+    check(isSame(drain(input, 195), {{MOVE_LEFT, 0}, {MOVE_RIGHT, 50}, {MOVE_RIGHT, 150}, {MOVE_RIGHT, 170}, {MOVE_RIGHT, 190}}),
+          "the direction pressed last repeats");
+    // Releasing it hands over to the held direction, which charges DAS again from the release
+    keyEvent(input, SDL_KEYUP, SDLK_RIGHT, 200);
+    check(drain(input, 299).empty(), "held direction waits DAS after the release");
+    check(isSame(drain(input, 320), {{MOVE_LEFT, 300}, {MOVE_LEFT, 320}}), "held direction repeats DAS after the release");
+
+    // Releasing the direction that is not repeating changes nothing
+    keyEvent(input, SDL_KEYDOWN, SDLK_RIGHT, 330);
+    keyEvent(input, SDL_KEYUP, SDLK_LEFT, 340);
+    check(isSame(drain(input, 430), {{MOVE_RIGHT, 330}, {MOVE_RIGHT, 430}}), "releasing the inactive direction keeps DAS");
+}
+
+static void testZeroArrClamped() {
+    Input input;
+    input.setDelays(100, 0);
+    keyEvent(input, SDL_KEYDOWN, SDLK_DOWN, 0);
+    check(isSame(drain(input, 103), {{SOFT_DROP, 0}, {SOFT_DROP, 100}, {SOFT_DROP, 101}, {SOFT_DROP, 102}, {SOFT_DROP, 103}}),
+          "ARR 0 repeats every millisecond");
+}
+
+static void testTimestampOrder() {
+    Input input;
+    input.setDelays(100, 50);
+    keyEvent(input, SDL_KEYDOWN, SDLK_DOWN, 0);
+    keyEvent(input, SDL_KEYDOWN, SDLK_UP, 160);
+    keyEvent(input, SDL_KEYDOWN, SDLK_SPACE, 210);
+    check(isSame(drain(input, 260), {{SOFT_DROP, 0}, {SOFT_DROP, 100}, {SOFT_DROP, 150}, {ROTATE, 160}, {SOFT_DROP, 200},
+                                    {HARD_DROP, 210}, {SOFT_DROP, 250}}),
+          "key events and due repeats pop in timestamp order");
+
+    // Soft drop and a horizontal direction repeat on their own schedules
+    keyEvent(input, SDL_KEYDOWN, SDLK_LEFT, 270);
+    check(isSame(drain(input, 380), {{MOVE_LEFT, 270}, {SOFT_DROP, 300}, {SOFT_DROP, 350}, {MOVE_LEFT, 370}}),
+          "repeats of two held keys interleave");
+}
+
+static void testGravityCatchUp() {
+    Uint32 lastTick = 0;
+    check(dueGravityTicks(499, 500, lastTick) == 0 && lastTick == 0, "no tick before the interval");
+    check(dueGravityTicks(500, 500, lastTick) == 1 && lastTick == 500, "tick on the interval");
+    check(dueGravityTicks(1100, 500, lastTick) == 1 && lastTick == 1000, "ticks stay on the grid");
+    check(dueGravityTicks(5200, 500, lastTick) == 1 && lastTick == 5200, "a stalled backlog collapses to one tick");
+    check(dueGravityTicks(5699, 500, lastTick) == 0 && dueGravityTicks(5700, 500, lastTick) == 1, "next tick an interval later");
+}
+
+int main() {
+    testDasThenArr();
+    testOsRepeatIgnored();
+    testLastDirectionWins();
+    testZeroArrClamped();
+    testTimestampOrder();
+    testGravityCatchUp();
+
+    if (failures == 0) {
+        std::cout << "input_test: all checks passed" << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,108 @@
+// Renders boards with Board::draw and with PlayfieldRaster on SDL's software renderer and checks
+// that they produce the same pixels, then times both at the game's window size
+#include "playfield_raster.h"
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+static const int WINDOW_WIDTH = 800; // Game window size
+static const int WINDOW_HEIGHT = 600;
+
+static int failures = 0;
+
+static void check(bool condition, const char *what) {
+    if (!condition) {
+        std::cerr << "FAILED: " << what << std::endl;
+        failures++;
+    }
+}
+
+static void renderFrame(SDL_Renderer *renderer, Board &board, PlayfieldRaster *raster) {
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+    SDL_RenderClear(renderer);
+    if (raster != nullptr) {
+        raster->draw(renderer, board);
+    } else {
+        board.draw(renderer);
+    }
+    SDL_RenderPresent(renderer);
+}
+
+// The window surface has no alpha channel, so only the color bits are compared
+static bool isSamePixels(const std::vector<Uint32> &a, const std::vector<Uint32> &b) {
+    for (size_t i = 0; i < a.size(); ++i) {
+        if ((a[i] & 0x00FFFFFF) != (b[i] & 0x00FFFFFF)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static double frameMs(SDL_Renderer *renderer, Board &board, PlayfieldRaster *raster, int frames) {
+    Uint64 start = SDL_GetPerformanceCounter();
+    for (int frame = 0; frame < frames; ++frame) {
+        // Move the piece every few frames, as gravity and input do in the game
+        if (frame % 8 == 0) {
+            board.movePieceDown();
+        }
+        renderFrame(renderer, board, raster);
+    }
+    return 1000.0 * (SDL_GetPerformanceCounter() - start) / SDL_GetPerformanceFrequency() / frames;
+}
+
+int main() {
+    if (SDL_Init(0) != 0) {
+        std::cerr << "SDL_Init Error: " << SDL_GetError() << std::endl;
+        return 2;
+    }
+    SDL_Surface *surface = SDL_CreateRGBSurfaceWithFormat(0, WINDOW_WIDTH, WINDOW_HEIGHT, 32, SDL_PIXELFORMAT_RGB888);
+    SDL_Renderer *renderer = surface != nullptr ? SDL_CreateSoftwareRenderer(surface) : nullptr;
+    if (renderer == nullptr) {
+        std::cerr << "Software renderer Error: " << SDL_GetError() << std::endl;
+        return 2;
+    }
+    PlayfieldRaster raster;
+    check(raster.create(renderer), "raster texture");
+
+    // One raster across all positions, so the dirty-row updates are covered as well as full redraws
+    srand(5);
+    Board board;
+    std::vector<Uint32> expected(WINDOW_WIDTH * WINDOW_HEIGHT);
+    std::vector<Uint32> actual(WINDOW_WIDTH * WINDOW_HEIGHT);
+    bool matches = true;
+    int positions = 0;
+    for (int move = 0; move < 200 && matches; ++move) {
+        if (board.isGameOver()) {
+            board = Board();
+        }
+        for (int fall = 0; fall < 3; ++fall) {
+            renderFrame(renderer, board, nullptr);
+            SDL_RenderReadPixels(renderer, NULL, SDL_PIXELFORMAT_RGB888, expected.data(), WINDOW_WIDTH * sizeof(Uint32));
+            renderFrame(renderer, board, &raster);
+            SDL_RenderReadPixels(renderer, NULL, SDL_PIXELFORMAT_RGB888, actual.data(), WINDOW_WIDTH * sizeof(Uint32));
+            matches = isSamePixels(expected, actual);
+            positions++;
+            board.movePieceDown();
+        }
+        board.placePiece(rand() % BOARD_WIDTH, rand() % 4);
+    }
+    check(matches, "PlayfieldRaster draws the same pixels as Board::draw");
+
+    srand(5);
+    Board timedBoard;
+    for (int move = 0; move < 40 && !timedBoard.isGameOver(); ++move) {
+        timedBoard.placePiece(rand() % BOARD_WIDTH, rand() % 4);
+    }
+    Board rasterBoard = timedBoard;
+    const int frames = 2000;
+    double drawMs = frameMs(renderer, timedBoard, nullptr, frames);
+    double rasterMs = frameMs(renderer, rasterBoard, &raster, frames);
+    std::cout << "playfield_raster_test: " << positions << " positions compared; software renderer frame "
+              << drawMs << " ms with Board::draw, " << rasterMs << " ms with PlayfieldRaster" << std::endl;
+
+    raster.destroy();
+    SDL_DestroyRenderer(renderer);
+    SDL_FreeSurface(surface);
+    SDL_Quit();
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,242 @@
+// Checks the search's choice at depth 1 against a cell-by-cell expectimax on fixed positions, then
+// plays AI moves under the default time budget and reports how often the search got past depth 0.
+// search_test --enforce-budget also fails if fewer than 90% of those moves reached depth 1.
+#include "board.h"
+#include "search.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+static const double GAME_OVER_VALUE = -1e9;
+
+static int failures = 0;
+
+static void check(bool condition, const char *what) {
+    if (!condition) {
+        std::cerr << "FAILED: " << what << std::endl;
+        failures++;
+    }
+}
+
+struct Grid {
+    bool cells[BOARD_HEIGHT][BOARD_WIDTH];
+};
+
+static bool isFit(const Grid &grid, const Piece &piece, int x, int y) {
+    for (int i = 0; i < 4; ++i) {
+        int cellX = x + piece.blocks[i].x;
+        int cellY = y + piece.blocks[i].y;
+        if (cellX < 0 || cellX >= BOARD_WIDTH || cellY >= BOARD_HEIGHT) {
+            return false;
+        }
+        if (cellY >= 0 && grid.cells[cellY][cellX]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Hard drops the piece at column x and clears full rows. Returns the lines cleared, or -1 if the
+// piece does not fit at row 0.
+static int place(Grid &grid, const Piece &piece, int x) {
+    if (!isFit(grid, piece, x, 0)) {
+        return -1;
+    }
+    int y = 0;
+    while (isFit(grid, piece, x, y + 1)) {
+        y++;
+    }
+    for (int i = 0; i < 4; ++i) {
+        if (y + piece.blocks[i].y >= 0) {
+            grid.cells[y + piece.blocks[i].y][x + piece.blocks[i].x] = true;
+        }
+    }
+    int lines = 0;
+    for (int row = 0; row < BOARD_HEIGHT; ++row) {
+        if (std::count(grid.cells[row], grid.cells[row] + BOARD_WIDTH, true) == BOARD_WIDTH) {
+            lines++;
+            for (int above = row; above > 0; --above) {
+                std::copy(grid.cells[above - 1], grid.cells[above - 1] + BOARD_WIDTH, grid.cells[above]);
+            }
+            std::fill(grid.cells[0], grid.cells[0] + BOARD_WIDTH, false);
+        }
+    }
+    return lines;
+}
+
+// LinearEvaluator's formula, counted cell by cell
+static double linearValue(const Grid &grid, int linesCleared) {
+    int heights[BOARD_WIDTH];
+    int totalHeight = 0;
+    int holes = 0;
+    for (int x = 0; x < BOARD_WIDTH; ++x) {
+        heights[x] = 0;
+        for (int y = 0; y < BOARD_HEIGHT; ++y) {
+            if (grid.cells[y][x]) {
+                if (heights[x] == 0) {
+                    heights[x] = BOARD_HEIGHT - y;
+                }
+            } else if (heights[x] != 0) {
+                holes++;
+            }
+        }
+        totalHeight += heights[x];
+    }
+    int bumpiness = 0;
+    for (int x = 1; x < BOARD_WIDTH; ++x) {
+        bumpiness += std::abs(heights[x] - heights[x - 1]);
+    }
+    return -0.5 * totalHeight + 0.76 * linesCleared - 0.35 * holes - 0.18 * bumpiness;
+}
+
+// Best leaf value over every rotation and column of the piece
+static double bestPlacement(const Grid &grid, Piece piece, int linesCleared) {
+    double best = GAME_OVER_VALUE;
+    for (int rotation = 0; rotation < 4; ++rotation) {
+        for (int x = 0; x < BOARD_WIDTH; ++x) {
+            Grid child = grid;
+            int lines = place(child, piece, x);
+            if (lines >= 0) {
+                best = std::max(best, linearValue(child, linesCleared + lines));
+            }
+        }
+        piece.rotate();
+    }
+    return best;
+}
+
+// Depth-1 expectimax value of every placement of the current piece: the next piece is any of the
+// 7 types with equal probability and is placed as well as possible. Non-fitting placements get
+// GAME_OVER_VALUE - 1.
+static void bruteForce(const Grid &grid, const Piece &current, double values[4][BOARD_WIDTH]) {
+    Piece piece = current;
+    for (int rotation = 0; rotation < 4; ++rotation) {
+        for (int x = 0; x < BOARD_WIDTH; ++x) {
+            Grid child = grid;
+            int lines = place(child, piece, x);
+            values[rotation][x] = GAME_OVER_VALUE - 1;
+            if (lines < 0) {
+                continue;
+            }
+            double total = 0;
+            for (int type = 0; type < 7; ++type) {
+                Piece next = current;
+                next.setType(static_cast<TetrominoType>(type));
+                total += bestPlacement(child, next, lines);
+            }
+            values[rotation][x] = total / 7;
+        }
+        piece.rotate();
+    }
+}
+
+// Returns the number of positions compared
+static int checkDepthOneChoices() {
+    static SearchContext context;
+    int positions = 0;
+    context.setMaxDepth(1);
+    for (int seed = 1; seed <= 40; ++seed) {
+        srand(seed);
+        Board board;
+        for (int move = 0; move < 2 + seed % 12 && !board.isGameOver(); ++move) {
+            board.placePiece(rand() % BOARD_WIDTH, rand() % 4);
+        }
+        if (board.isGameOver()) {
+            continue;
+        }
+
+        Grid grid;
+        BitBoard root;
+        for (int y = 0; y < BOARD_HEIGHT; ++y) {
+            root.rows[y] = 0;
+            for (int x = 0; x < BOARD_WIDTH; ++x) {
+                grid.cells[y][x] = board.isCellFilled(x, y);
+                if (grid.cells[y][x]) {
+                    root.rows[y] |= static_cast<Row>(1 << x);
+                }
+            }
+        }
+        const Piece &current = board.getCurrentPiece();
+        positions++;
+        double values[4][BOARD_WIDTH];
+        bruteForce(grid, current, values);
+        double best = GAME_OVER_VALUE - 1;
+        for (int rotation = 0; rotation < 4; ++rotation) {
+            for (int x = 0; x < BOARD_WIDTH; ++x) {
+                best = std::max(best, values[rotation][x]);
+            }
+        }
+
+        int bestX = -1;
+        int bestRotation = -1;
+        context.search(root, current, 1e6, bestX, bestRotation);
+        check(context.getLastSearchDepth() == 1, "unbounded search completes depth 1");
+        check(bestX >= 0 && bestX < BOARD_WIDTH && bestRotation >= 0 && bestRotation < 4, "search returns a placement");
+        if (bestX < 0 || bestX >= BOARD_WIDTH || bestRotation < 0 || bestRotation >= 4) {
+            continue;
+        }
+        Piece rotated = current;
+        for (int r = 0; r < bestRotation; ++r) {
+            rotated.rotate();
+        }
+        check(board.isPieceFit(rotated, bestX, 0), "returned placement fits at row 0");
+        check(std::fabs(values[bestRotation][bestX] - best) <= 1e-3 * std::max(1.0, std::fabs(best)),
+              "returned placement has the best depth-1 expectimax value");
+    }
+    return positions;
+}
+
+int main(int argc, char *argv[]) {
+    bool isBudgetEnforced = argc > 1 && strcmp(argv[1], "--enforce-budget") == 0;
+    if (SDL_Init(SDL_INIT_TIMER) != 0) {
+        std::cerr << "SDL_Init Error: " << SDL_GetError() << std::endl;
+        return 2;
+    }
+
+    int positions = checkDepthOneChoices();
+    check(positions >= 20, "enough positions for the depth-1 comparison");
+    std::cout << "search_test: depth-1 choice compared with brute-force expectimax on " << positions << " positions" << std::endl;
+
+    srand(7);
+    const int moves = 300;
+    static SearchContext context;
+    Board board;
+    int deepMoves = 0;
+    int maxDepth = 0;
+    double worstMs = 0;
+    for (int move = 0; move < moves; ++move) {
+        if (board.isGameOver()) {
+            board = Board();
+        }
+        int bestX = 0;
+        int bestRotation = 0;
+        Uint64 start = SDL_GetPerformanceCounter();
+        board.bestMove(bestX, bestRotation, context);
+        double ms = 1000.0 * (SDL_GetPerformanceCounter() - start) / SDL_GetPerformanceFrequency();
+        if (move >= 10) { // Skip cold-cache moves
+            worstMs = std::max(worstMs, ms);
+            if (context.getLastSearchDepth() >= 1) {
+                deepMoves++;
+            }
+        }
+        maxDepth = std::max(maxDepth, context.getLastSearchDepth());
+        board.placePiece(bestX, bestRotation);
+    }
+
+    // Depends on the machine and build type, so only enforced on request; allow for the odd move
+    // that a busy machine cuts short
+    int measured = moves - 10;
+    std::cout << "search_test: " << deepMoves << "/" << measured << " moves reached depth >= 1 in " << AI_MOVE_BUDGET_MS
+              << " ms (deepest " << maxDepth << ", worst call " << worstMs << " ms)" << std::endl;
+    if (isBudgetEnforced) {
+        check(deepMoves * 10 >= measured * 9, "90% of moves reach depth 1 within the budget");
+    }
+    SDL_Quit();
+
+    if (failures == 0) {
+        std::cout << "search_test: all checks passed" << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,123 @@
+// Solves the puzzles in puzzles/ and replays each solution cell by cell on a Board to check that it
+// reaches the goal: solver_test <puzzles directory>
+#include "solver.h"
+#include <iostream>
+#include <string>
+
+static int failures = 0;
+
+static void check(bool condition, const char *what) {
+    if (!condition) {
+        std::cerr << "FAILED: " << what << std::endl;
+        failures++;
+    }
+}
+
+// Places the steps with Board's own collision test and clears full rows. Returns false if a step
+// does not fit; lines receives the number of lines cleared.
+static bool replay(const Puzzle &puzzle, const std::vector<SolutionStep> &steps, Board &board, int &lines) {
+    board = puzzle.board;
+    lines = 0;
+    for (size_t i = 0; i < steps.size(); ++i) {
+        const SolutionStep &step = steps[i];
+        if (step.type != puzzle.pieces[i]) {
+            return false;
+        }
+        Piece piece = board.getCurrentPiece();
+        piece.setType(step.type);
+        for (int r = 0; r < step.rotation; ++r) {
+            piece.rotate();
+        }
+        if (!board.isPieceFit(piece, step.x, 0)) {
+            return false;
+        }
+        int y = 0;
+        while (board.isPieceFit(piece, step.x, y + 1)) {
+            y++;
+        }
+        for (int b = 0; b < 4; ++b) {
+            board.setCellFilled(step.x + piece.blocks[b].x, y + piece.blocks[b].y, true);
+        }
+
+        int write = BOARD_HEIGHT - 1;
+        for (int read = BOARD_HEIGHT - 1; read >= 0; --read) {
+            bool isFull = true;
+            for (int x = 0; x < BOARD_WIDTH; ++x) {
+                isFull = isFull && board.isCellFilled(x, read);
+            }
+            if (isFull) {
+                lines++;
+                continue;
+            }
+            for (int x = 0; x < BOARD_WIDTH; ++x) {
+                board.setCellFilled(x, write, board.isCellFilled(x, read));
+            }
+            write--;
+        }
+        for (; write >= 0; --write) {
+            for (int x = 0; x < BOARD_WIDTH; ++x) {
+                board.setCellFilled(x, write, false);
+            }
+        }
+    }
+    return true;
+}
+
+static bool isEmpty(const Board &board) {
+    for (int y = 0; y < BOARD_HEIGHT; ++y) {
+        for (int x = 0; x < BOARD_WIDTH; ++x) {
+            if (board.isCellFilled(x, y)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static void checkPuzzle(const std::string &path, size_t expectedPieces, PuzzleMemo &memo) {
+    Puzzle puzzle;
+    if (!loadPuzzle(path.c_str(), puzzle)) {
+        check(false, "puzzle loads");
+        return;
+    }
+    for (int threads = 1; threads <= 4; threads *= 4) {
+        SolveResult result = solvePuzzle(puzzle, threads, memo);
+        std::cout << path << ": " << threads << " threads, " << result.steps.size() << " pieces, " << result.nodes << " nodes" << std::endl;
+        check(result.solved, "puzzle solved");
+        check(result.steps.size() == expectedPieces, "solution uses the fewest pieces");
+
+        Board board;
+        int lines = 0;
+        check(replay(puzzle, result.steps, board, lines), "solution replays");
+        if (puzzle.goal == PERFECT_CLEAR) {
+            check(isEmpty(board), "replayed solution clears the board");
+        } else {
+            check(lines >= puzzle.targetLines, "replayed solution clears the target lines");
+        }
+    }
+
+    // One piece short of the solution cannot succeed
+    puzzle.pieces.resize(expectedPieces - 1);
+    check(!solvePuzzle(puzzle, 1, memo).solved, "puzzle unsolvable with fewer pieces");
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 2) {
+        std::cerr << "usage: solver_test <puzzles directory>" << std::endl;
+        return 2;
+    }
+    std::string directory = argv[1];
+
+    // One memo across all solves, so entries left by earlier puzzles must never be mistaken for
+    // states of later ones
+    PuzzleMemo memo;
+    checkPuzzle(directory + "/two_lines.txt", 2, memo);
+    checkPuzzle(directory + "/perfect_clear_4.txt", 4, memo);
+    checkPuzzle(directory + "/floating_rows.txt", 1, memo);
+    checkPuzzle(directory + "/two_lines.txt", 2, memo);
+
+    if (failures == 0) {
+        std::cout << "solver_test: all checks passed" << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,279 @@
+// Steps the training environment against boards replayed independently in the test, and runs the
+// shared-memory transport between a server thread and a client mapping of the same segment
+#include "tetris_env.h"
+#include "board.h"
+#include "search.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+static int failures = 0;
+
+static void check(bool condition, const char *what) {
+    if (!condition) {
+        std::cerr << "FAILED: " << what << std::endl;
+        failures++;
+    }
+}
+
+static bool isObservationOf(const Board &board, const uint8_t *observation) {
+    for (int y = 0; y < BOARD_HEIGHT; ++y) {
+        for (int x = 0; x < BOARD_WIDTH; ++x) {
+            if (observation[y * BOARD_WIDTH + x] != (board.isCellFilled(x, y) ? 1 : 0)) {
+                return false;
+            }
+        }
+    }
+    return observation[BOARD_WIDTH * BOARD_HEIGHT] == board.getCurrentPiece().type;
+}
+
+static bool isEmptyBoard(const uint8_t *observation) {
+    for (int i = 0; i < BOARD_WIDTH * BOARD_HEIGHT; ++i) {
+        if (observation[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Board 0 is played by the AI so it clears lines, board 1 always stacks in column 0 so it tops
+// out and resets. Both are mirrored by boards seeded the way the env seeds its own.
+// Every action on an empty board, checked cell by cell: a piece that fits at its target column
+// lands there on the floor, and one that does not stops against the wall on the way
+static void testPlacePiece() {
+    bool landsOnTarget = true;
+    bool staysInside = true;
+    for (int action = 0; action < TETRIS_ENV_ACTION_COUNT; ++action) {
+        Board board(3);
+        Piece piece = board.getCurrentPiece();
+        int x = action % BOARD_WIDTH;
+        for (int r = 0; r < action / BOARD_WIDTH; ++r) {
+            piece.rotate();
+        }
+        int maxY = -BOARD_HEIGHT;
+        for (int i = 0; i < 4; ++i) {
+            maxY = std::max(maxY, piece.blocks[i].y);
+        }
+        bool isReachable = board.isPieceFit(piece, x, 0);
+
+        board.placePiece(x, action / BOARD_WIDTH);
+        int filled = 0;
+        for (int y = 0; y < BOARD_HEIGHT; ++y) {
+            for (int column = 0; column < BOARD_WIDTH; ++column) {
+                filled += board.isCellFilled(column, y) ? 1 : 0;
+            }
+        }
+        staysInside = staysInside && filled == 4;
+        if (isReachable) {
+            for (int i = 0; i < 4; ++i) {
+                landsOnTarget = landsOnTarget && board.isCellFilled(x + piece.blocks[i].x, BOARD_HEIGHT - 1 - maxY + piece.blocks[i].y);
+            }
+        }
+    }
+    check(landsOnTarget, "placePiece drops a piece at its target column onto the floor");
+    check(staysInside, "placePiece keeps all four cells on the board");
+}
+
+static void testStepAgainstMirror() {
+    const uint32_t seed = 42;
+    TetrisEnv *env = tetris_env_create(2, seed);
+    check(env != nullptr, "tetris_env_create");
+    if (env == nullptr) {
+        return;
+    }
+    TetrisEnvBuffers buffers = tetris_env_buffers(env);
+
+    std::mt19937 boardSeeds(seed);
+    std::vector<Board> mirrors;
+    mirrors.push_back(Board(boardSeeds()));
+    mirrors.push_back(Board(boardSeeds()));
+    static SearchContext context;
+
+    bool observationsMatch = true;
+    bool rewardsMatch = true;
+    bool donesMatch = true;
+    bool resetsAreEmpty = true;
+    float totalReward = 0;
+    int dones = 0;
+    for (int step = 0; step < 400; ++step) {
+        int bestX = 0;
+        int bestRotation = 0;
+        mirrors[0].bestMove(bestX, bestRotation, context);
+        int32_t actions[2] = {bestRotation * BOARD_WIDTH + bestX, 0};
+        tetris_env_step(env, actions);
+
+        for (int i = 0; i < 2; ++i) {
+            int scoreBefore = mirrors[i].getScore();
+            mirrors[i].placePiece(actions[i] % BOARD_WIDTH, actions[i] / BOARD_WIDTH);
+            rewardsMatch = rewardsMatch && buffers.rewards[i] == static_cast<float>(mirrors[i].getScore() - scoreBefore);
+            donesMatch = donesMatch && buffers.dones[i] == (mirrors[i].isGameOver() ? 1 : 0);
+            totalReward += buffers.rewards[i];
+            const uint8_t *observation = buffers.observations + i * TETRIS_ENV_OBS_SIZE;
+            if (mirrors[i].isGameOver()) {
+                dones++;
+                mirrors[i] = Board(boardSeeds());
+                resetsAreEmpty = resetsAreEmpty && isEmptyBoard(observation);
+            }
+            observationsMatch = observationsMatch && isObservationOf(mirrors[i], observation);
+        }
+    }
+    tetris_env_destroy(env);
+    check(observationsMatch, "observations match the mirrored boards");
+    check(rewardsMatch, "rewards are the score gained by each step");
+    check(donesMatch, "dones flag boards that topped out");
+    check(resetsAreEmpty, "a board that topped out is reset to an empty board");
+    check(totalReward > 0, "the AI board scores");
+    check(dones > 0, "the stacking board tops out");
+}
+
+static bool isSameResults(TetrisEnv *a, TetrisEnv *b, int count) {
+    TetrisEnvBuffers bufferA = tetris_env_buffers(a);
+    TetrisEnvBuffers bufferB = tetris_env_buffers(b);
+    return memcmp(bufferA.observations, bufferB.observations, count * TETRIS_ENV_OBS_SIZE) == 0 &&
+           memcmp(bufferA.rewards, bufferB.rewards, count * sizeof(float)) == 0 &&
+           memcmp(bufferA.dones, bufferB.dones, count) == 0;
+}
+
+static void stepRandomly(TetrisEnv *env, int count, std::mt19937 &actions, int steps) {
+    std::vector<int32_t> stepActions(count);
+    for (int step = 0; step < steps; ++step) {
+        for (int i = 0; i < count; ++i) {
+            stepActions[i] = static_cast<int32_t>(actions() % TETRIS_ENV_ACTION_COUNT);
+        }
+        tetris_env_step(env, stepActions.data());
+    }
+}
+
+// Envs with the same seed play the same games, whatever else uses rand() or other envs meanwhile
+static void testSeedsAreIndependent() {
+    const int count = 3;
+    TetrisEnv *first = tetris_env_create(count, 5);
+    std::mt19937 firstActions(1);
+    stepRandomly(first, count, firstActions, 50);
+
+    srand(1234);
+    TetrisEnv *other = tetris_env_create(count, 9);
+    std::mt19937 otherActions(2);
+    stepRandomly(other, count, otherActions, 50);
+    for (int i = 0; i < 100; ++i) {
+        rand();
+    }
+
+    TetrisEnv *second = tetris_env_create(count, 5);
+    std::mt19937 secondActions(1);
+    stepRandomly(second, count, secondActions, 50);
+    check(isSameResults(first, second, count), "envs with the same seed match");
+
+    tetris_env_reset(first);
+    tetris_env_reset(second);
+    check(isSameResults(first, second, count), "resets of envs with the same seed match");
+    TetrisEnvBuffers buffers = tetris_env_buffers(first);
+    bool isCleared = true;
+    for (int i = 0; i < count; ++i) {
+        isCleared = isCleared && isEmptyBoard(buffers.observations + i * TETRIS_ENV_OBS_SIZE) &&
+                    buffers.rewards[i] == 0 && buffers.dones[i] == 0;
+    }
+    check(isCleared, "reset clears boards, rewards and dones");
+
+    tetris_env_destroy(first);
+    tetris_env_destroy(other);
+    tetris_env_destroy(second);
+}
+
+#ifndef _WIN32
+// A server thread serves a shared env. The client maps the segment separately, as another process
+// would, and must see the same results as an in-process env with the same seed.
+static void testSharedTransport() {
+    const int count = 4;
+    const uint32_t seed = 11;
+    std::string name = "/tetris_env_test_" + std::to_string(getpid());
+    TetrisEnv *shared = tetris_env_create_shared(name.c_str(), count, seed);
+    check(shared != nullptr, "tetris_env_create_shared");
+    if (shared == nullptr) {
+        return;
+    }
+
+    void *block = MAP_FAILED;
+    size_t size = 0;
+    int fd = shm_open(name.c_str(), O_RDWR, 0600);
+    if (fd >= 0) {
+        TetrisEnvHeader header;
+        if (pread(fd, &header, sizeof(header), 0) == static_cast<ssize_t>(sizeof(header))) {
+            size = header.totalSize;
+            block = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        }
+        close(fd);
+    }
+    check(block != MAP_FAILED, "client mapping of the served segment");
+    if (block == MAP_FAILED) {
+        tetris_env_destroy(shared);
+        return;
+    }
+
+    TetrisEnvHeader *header = static_cast<TetrisEnvHeader *>(block);
+    char *base = static_cast<char *>(block);
+    int32_t *actions = reinterpret_cast<int32_t *>(base + header->actionsOffset);
+    TetrisEnvBuffers client = {actions, reinterpret_cast<uint8_t *>(base + header->observationsOffset),
+                               reinterpret_cast<float *>(base + header->rewardsOffset),
+                               reinterpret_cast<uint8_t *>(base + header->donesOffset)};
+
+    TetrisEnv *local = tetris_env_create(count, seed);
+    TetrisEnvBuffers expected = tetris_env_buffers(local);
+    std::thread server(tetris_env_serve, shared);
+
+    std::mt19937 random(3);
+    bool matches = true;
+    for (int step = 0; step < 300; ++step) {
+        if (step % 100 == 99) {
+            tetris_env_post(header, TETRIS_ENV_RESET);
+            tetris_env_reset(local);
+        } else {
+            for (int i = 0; i < count; ++i) {
+                actions[i] = static_cast<int32_t>(random() % TETRIS_ENV_ACTION_COUNT);
+            }
+            tetris_env_post(header, TETRIS_ENV_STEP);
+            tetris_env_step(local, actions);
+        }
+        matches = matches && memcmp(client.observations, expected.observations, count * TETRIS_ENV_OBS_SIZE) == 0 &&
+                  memcmp(client.rewards, expected.rewards, count * sizeof(float)) == 0 &&
+                  memcmp(client.dones, expected.dones, count) == 0;
+    }
+    check(matches, "results posted through shared memory match the in-process env");
+
+    tetris_env_post(header, TETRIS_ENV_SHUTDOWN);
+    server.join();
+    check(header->response == header->request, "server answered every request");
+    munmap(block, size);
+    tetris_env_destroy(local);
+    tetris_env_destroy(shared);
+}
+#endif
+
+int main() {
+    if (SDL_Init(SDL_INIT_TIMER) != 0) {
+        std::cerr << "SDL_Init Error: " << SDL_GetError() << std::endl;
+        return 2;
+    }
+    testPlacePiece();
+    testStepAgainstMirror();
+    testSeedsAreIndependent();
+#ifndef _WIN32
+    testSharedTransport();
+#endif
+    SDL_Quit();
+    if (failures == 0) {
+        std::cout << "tetris_env_test: all checks passed" << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}
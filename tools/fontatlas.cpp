@@ -0,0 +1,126 @@
+#include <SDL.h>
+#include <SDL_ttf.h>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+// Rasterizes the printable ASCII range of a TrueType font into a 1-bit alpha atlas (the same look
+// as TTF_RenderText_Solid) and writes it out as a C++ header for src/font.cpp. The output is
+// committed as include/font_atlas.h; rerun this after changing the font or its size, or configure
+// with -DREGENERATE_FONT_ATLAS=ON to have the build do it.
+
+const int FIRST_CHAR = 32;
+const int LAST_CHAR = 126;
+const int MAX_ATLAS_WIDTH = 512;
+
+static void writeArray(std::ofstream &out, const char *declaration, const std::vector<int> &values, bool hex = false) {
+    out << declaration << " = {";
+    for (size_t i = 0; i < values.size(); ++i) {
+        if (i % 24 == 0) {
+            out << "\n   ";
+        }
+        if (hex) {
+            static const char digits[] = "0123456789abcdef";
+            out << " 0x" << digits[values[i] >> 4 & 15] << digits[values[i] & 15] << ",";
+        } else {
+            out << " " << values[i] << ",";
+        }
+    }
+    out << "\n};\n";
+}
+
+int main(int argc, char* argv[]) {
+    if (argc != 4) {
+        std::cerr << "Usage: fontatlas <font.ttf> <point size> <output.h>" << std::endl;
+        return 1;
+    }
+
+    if (TTF_Init() == -1) {
+        std::cerr << "TTF_Init Error: " << TTF_GetError() << std::endl;
+        return 1;
+    }
+
+    TTF_Font *font = TTF_OpenFont(argv[1], atoi(argv[2]));
+    if (font == nullptr) {
+        std::cerr << "TTF_OpenFont Error: " << TTF_GetError() << std::endl;
+        TTF_Quit();
+        return 1;
+    }
+
+    int glyphCount = LAST_CHAR - FIRST_CHAR + 1;
+    int lineHeight = TTF_FontHeight(font);
+    std::vector<SDL_Surface *> surfaces(glyphCount, nullptr);
+    std::vector<int> glyphX(glyphCount), glyphY(glyphCount), glyphW(glyphCount), glyphAdvance(glyphCount);
+
+    // Pack the glyphs left to right into rows of lineHeight pixels
+    int penX = 0;
+    int penY = 0;
+    SDL_Color white = {255, 255, 255, 255};
+    for (int i = 0; i < glyphCount; ++i) {
+        Uint16 ch = static_cast<Uint16>(FIRST_CHAR + i);
+        int minX, maxX, minY, maxY, advance;
+        if (TTF_GlyphMetrics(font, ch, &minX, &maxX, &minY, &maxY, &advance) == -1) {
+            advance = 0;
+        }
+        surfaces[i] = TTF_RenderGlyph_Solid(font, ch, white);
+        int w = surfaces[i] != nullptr ? surfaces[i]->w : 0;
+        if (penX + w > MAX_ATLAS_WIDTH) {
+            penX = 0;
+            penY += lineHeight;
+        }
+        glyphX[i] = penX;
+        glyphY[i] = penY;
+        glyphW[i] = w;
+        glyphAdvance[i] = advance;
+        penX += w;
+    }
+    int atlasWidth = MAX_ATLAS_WIDTH;
+    int atlasHeight = penY + lineHeight;
+
+    // Solid glyphs are 8-bit palettized: index 0 is the background, anything else is ink. Pixel i
+    // is stored in bit i % 8 of byte i / 8.
+    std::vector<int> ink((atlasWidth * atlasHeight + 7) / 8, 0);
+    for (int i = 0; i < glyphCount; ++i) {
+        SDL_Surface *surface = surfaces[i];
+        if (surface == nullptr) {
+            continue;
+        }
+        SDL_LockSurface(surface);
+        for (int y = 0; y < surface->h && y < lineHeight; ++y) {
+            const Uint8 *row = static_cast<const Uint8 *>(surface->pixels) + y * surface->pitch;
+            for (int x = 0; x < surface->w; ++x) {
+                if (row[x] != 0) {
+                    int pixel = (glyphY[i] + y) * atlasWidth + glyphX[i] + x;
+                    ink[pixel / 8] |= 1 << (pixel % 8);
+                }
+            }
+        }
+        SDL_UnlockSurface(surface);
+        SDL_FreeSurface(surface);
+    }
+
+    TTF_CloseFont(font);
+    TTF_Quit();
+
+    std::ofstream out(argv[3]);
+    if (!out) {
+        std::cerr << "Cannot write " << argv[3] << std::endl;
+        return 1;
+    }
+    out << "// Generated by tools/fontatlas.cpp at " << argv[2] << " points, do not edit\n";
+    out << "#ifndef FONT_ATLAS_H\n#define FONT_ATLAS_H\n\n";
+    out << "const int FONT_ATLAS_FIRST_CHAR = " << FIRST_CHAR << ";\n";
+    out << "const int FONT_ATLAS_GLYPH_COUNT = " << glyphCount << ";\n";
+    out << "const int FONT_ATLAS_WIDTH = " << atlasWidth << ";\n";
+    out << "const int FONT_ATLAS_HEIGHT = " << atlasHeight << ";\n";
+    out << "const int FONT_ATLAS_LINE_HEIGHT = " << lineHeight << ";\n\n";
+    writeArray(out, "const int FONT_ATLAS_GLYPH_X[]", glyphX);
+    writeArray(out, "const int FONT_ATLAS_GLYPH_Y[]", glyphY);
+    writeArray(out, "const int FONT_ATLAS_GLYPH_W[]", glyphW);
+    writeArray(out, "const int FONT_ATLAS_GLYPH_ADVANCE[]", glyphAdvance);
+    out << "\n";
+    writeArray(out, "const unsigned char FONT_ATLAS_INK[]", ink, true);
+    out << "\n#endif // FONT_ATLAS_H\n";
+    return 0;
+}
@@ -0,0 +1,81 @@
+"""Minimal client for tetris_env_server: maps the shared block and steps all boards with numpy.
+
+Usage: start `tetris_env_server tetris 64`, then run `python tetris_env_client.py tetris [library]`
+from the build directory. Requests go through tetris_env_post in the tetris_env library, which
+does the atomic handshake and blocks without spinning; library defaults to the one built next to
+the server.
+"""
+import ctypes
+import mmap
+import os
+import struct
+import sys
+
+import numpy as np
+
+HEADER = struct.Struct("<IIiiIIIIIiII")
+MAGIC = 0x54454E56
+VERSION = 2
+STEP, RESET, SHUTDOWN = 0, 1, 2
+ACTION_COUNT = 40
+LIBRARY_NAMES = {"nt": "libtetris_env.dll", "darwin": "libtetris_env.dylib"}
+
+
+def default_library():
+    key = "darwin" if sys.platform == "darwin" else os.name
+    return os.path.abspath(LIBRARY_NAMES.get(key, "libtetris_env.so"))
+
+
+class TetrisEnvClient:
+    def __init__(self, name, library=None):
+        if os.name == "nt":
+            probe = mmap.mmap(-1, HEADER.size, tagname=name)
+            total_size = HEADER.unpack_from(probe)[8]
+            probe.close()
+            self.block = mmap.mmap(-1, total_size, tagname=name)
+        else:
+            fd = os.open("/dev/shm/" + name.lstrip("/"), os.O_RDWR)
+            self.block = mmap.mmap(fd, 0)
+            os.close(fd)
+
+        (magic, version, count, obs_size, actions, observations, rewards, dones,
+         _total, _command, _request, _response) = HEADER.unpack_from(self.block)
+        if magic != MAGIC or version != VERSION:
+            raise RuntimeError("not a version %d tetris env block" % VERSION)
+        self.count = count
+        self.actions = np.frombuffer(self.block, np.int32, count, actions)
+        self.observations = np.frombuffer(self.block, np.uint8, count * obs_size, observations).reshape(count, obs_size)
+        self.rewards = np.frombuffer(self.block, np.float32, count, rewards)
+        self.dones = np.frombuffer(self.block, np.uint8, count, dones)
+
+        self.library = ctypes.CDLL(library or default_library())
+        self.library.tetris_env_post.argtypes = [ctypes.c_void_p, ctypes.c_int32]
+        self.library.tetris_env_post.restype = None
+        self.header = ctypes.c_char.from_buffer(self.block)
+
+    def _run(self, command):
+        # ctypes releases the GIL for the call, so other Python threads keep running while it waits
+        self.library.tetris_env_post(ctypes.addressof(self.header), command)
+
+    def reset(self):
+        self._run(RESET)
+        return self.observations
+
+    def step(self, actions):
+        self.actions[:] = actions
+        self._run(STEP)
+        return self.observations, self.rewards, self.dones
+
+    def close(self):
+        self._run(SHUTDOWN)
+
+
+if __name__ == "__main__":
+    env = TetrisEnvClient(sys.argv[1] if len(sys.argv) > 1 else "tetris", sys.argv[2] if len(sys.argv) > 2 else None)
+    env.reset()
+    total = 0.0
+    for _ in range(1000):
+        _, rewards, dones = env.step(np.random.randint(0, ACTION_COUNT, env.count))
+        total += float(rewards.sum())
+    print("boards:", env.count, "total reward:", total)
+    env.close()
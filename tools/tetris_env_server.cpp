@@ -0,0 +1,25 @@
+#include "tetris_env.h"
+#include <cstdlib>
+#include <iostream>
+
+// Hosts a shared-memory training environment for an external trainer such as
+// tools/tetris_env_client.py, until the trainer sends TETRIS_ENV_SHUTDOWN.
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::cerr << "Usage: tetris_env_server <shared memory name> <board count> [seed]" << std::endl;
+        return 1;
+    }
+
+    int count = atoi(argv[2]);
+    unsigned int seed = argc > 3 ? static_cast<unsigned int>(strtoul(argv[3], nullptr, 10)) : 0;
+    TetrisEnv *env = tetris_env_create_shared(argv[1], count, seed);
+    if (env == nullptr) {
+        std::cerr << "Cannot create shared environment " << argv[1] << " with " << count << " boards" << std::endl;
+        return 1;
+    }
+
+    std::cout << "Serving " << count << " boards on " << argv[1] << std::endl;
+    int result = tetris_env_serve(env);
+    tetris_env_destroy(env);
+    return result;
+}